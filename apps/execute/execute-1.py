@@ -35,7 +35,7 @@
 #
 ##########################################################################
 
-import os, sys, traceback
+import os, sys, json, traceback
 
 import imath
 
@@ -60,6 +60,11 @@ class execute( Gaffer.Application ) :
 			```
 			gaffer execute -script comp.gfr -nodes ImageWriter -frames 1-10
 			```
+
+			When run with the `-worker` flag, the script is loaded once and
+			the process then executes a series of batches read from stdin,
+			one per line. This allows dispatchers to avoid the cost of
+			reloading the script for every batch.
 			"""
 		)
 
@@ -89,6 +94,15 @@ class execute( Gaffer.Application ) :
 					defaultValue = IECore.StringVectorData( [] ),
 				),
 
+				IECore.BoolParameter(
+					name = "partialLoad",
+					description = "Loads only the nodes specified by the nodes parameter, "
+						"along with the nodes they depend on, rather than the whole script. "
+						"This can significantly reduce load times for large scripts. Has "
+						"no effect unless nodes are specified, or when running as a worker.",
+					defaultValue = False,
+				),
+
 				IECore.FrameListParameter(
 					name = "frames",
 					description = "The frames to execute. The default value executes "
@@ -97,6 +111,18 @@ class execute( Gaffer.Application ) :
 					allowEmptyList = True,
 				),
 
+				IECore.BoolParameter(
+					name = "worker",
+					description = "Runs as a persistent worker process, loading the "
+						"script once and then executing batches read from stdin. Each "
+						"batch is a single line of JSON of the form "
+						"`{ \"nodes\" : [], \"frames\" : \"\", \"context\" : [] }`, "
+						"with the same meaning as the equivalent command line parameters. "
+						"After each batch, a single line containing the exit status is "
+						"written to stdout. The process exits when stdin is closed.",
+					defaultValue = False,
+				),
+
 				IECore.StringVectorParameter(
 					name = "context",
 					description = "The context used during execution. Note that the frames "
@@ -124,16 +150,67 @@ class execute( Gaffer.Application ) :
 		scriptNode = Gaffer.ScriptNode()
 		scriptNode["fileName"].setValue( os.path.abspath( args["script"].value ) )
 		try :
-			scriptNode.load( continueOnError = args["ignoreScriptLoadErrors"].value )
+			if args["partialLoad"].value and len( args["nodes"] ) and not args["worker"].value :
+				scriptNode.load(
+					nodes = [ n.split( "." )[0] for n in args["nodes"] ],
+					continueOnError = args["ignoreScriptLoadErrors"].value
+				)
+			else :
+				scriptNode.load( continueOnError = args["ignoreScriptLoadErrors"].value )
 		except Exception as exception :
 			IECore.msg( IECore.Msg.Level.Error, "gaffer execute : loading \"%s\"" % scriptNode["fileName"].getValue(), str( exception ) )
 			return 1
 
 		self.root()["scripts"].addChild( scriptNode )
 
+		if args["worker"].value :
+			return self.__runWorker( scriptNode )
+
+		return self.__execute(
+			scriptNode,
+			args["nodes"],
+			self.parameters()["frames"].getFrameListValue().asList(),
+			args["context"]
+		)
+
+	def __runWorker( self, scriptNode ) :
+
+		# Take private copies of stdin and stdout for communicating with
+		# the dispatcher, and redirect the originals so that any output
+		# from the tasks themselves can't be mistaken for our replies.
+		commands = os.fdopen( os.dup( sys.stdin.fileno() ), "r" )
+		replies = os.fdopen( os.dup( sys.stdout.fileno() ), "w" )
+		sys.stdout.flush()
+		os.dup2( sys.stderr.fileno(), sys.stdout.fileno() )
+		with open( os.devnull, "r" ) as devNull :
+			os.dup2( devNull.fileno(), sys.stdin.fileno() )
+
+		for line in iter( commands.readline, "" ) :
+
+			try :
+				batch = json.loads( line )
+				# JSON gives us unicode, but our bindings expect str.
+				frames = IECore.FrameList.parse( str( batch.get( "frames", "" ) ) ).asList()
+				result = self.__execute(
+					scriptNode,
+					[ str( x ) for x in batch.get( "nodes", [] ) ],
+					frames,
+					[ str( x ) for x in batch.get( "context", [] ) ]
+				)
+			except Exception as exception :
+				IECore.msg( IECore.Msg.Level.Error, "gaffer execute : worker", str( exception ) )
+				result = 1
+
+			replies.write( "%d\n" % result )
+			replies.flush()
+
+		return 0
+
+	def __execute( self, scriptNode, nodeNames, frames, contextArgs ) :
+
 		nodes = []
-		if len( args["nodes"] ) :
-			for nodeName in args["nodes"] :
+		if len( nodeNames ) :
+			for nodeName in nodeNames :
 				node = scriptNode.descendant( nodeName )
 				if node is None :
 					IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Node \"%s\" does not exist" % nodeName )
@@ -150,16 +227,15 @@ class execute( Gaffer.Application ) :
 				IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Script has no executable nodes" )
 				return 1
 
-		if len(args["context"]) % 2 :
+		if len( contextArgs ) % 2 :
 			IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Context parameter must have matching entry/value pairs" )
 			return 1
 
 		context = Gaffer.Context( scriptNode.context() )
-		for i in range( 0, len(args["context"]), 2 ) :
-			entry = args["context"][i].lstrip( "-" )
-			context[entry] = eval( args["context"][i+1] )
+		for i in range( 0, len( contextArgs ), 2 ) :
+			entry = contextArgs[i].lstrip( "-" )
+			context[entry] = eval( contextArgs[i+1] )
 
-		frames = self.parameters()["frames"].getFrameListValue().asList()
 		if not frames :
 			frames = [ scriptNode.context().getFrame() ]
 
@@ -0,0 +1,153 @@
+##########################################################################
+#
+#  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import os
+import gc
+import sys
+import time
+
+import IECore
+
+import Gaffer
+
+class loadBenchmark( Gaffer.Application ) :
+
+	def __init__( self ) :
+
+		Gaffer.Application.__init__(
+			self,
+			"""
+			Measures the time taken to load a Gaffer script. The script is
+			loaded repeatedly, and the fastest and mean times are reported.
+
+			To compare the native execution of the script with execution
+			in python :
+
+			```
+			gaffer loadBenchmark fileName.gfr -compare
+			```
+			"""
+		)
+
+		self.parameters().addParameters(
+
+			[
+				IECore.FileNameParameter(
+					name = "script",
+					description = "The script to load.",
+					defaultValue = "",
+					allowEmptyString = False,
+					extensions = "gfr",
+					check = IECore.FileNameParameter.CheckType.MustExist,
+				),
+
+				IECore.IntParameter(
+					name = "repeat",
+					description = "The number of times to load the script.",
+					defaultValue = 5,
+					minValue = 1,
+				),
+
+				IECore.BoolParameter(
+					name = "compare",
+					description = "Also loads the script with native execution "
+						"disabled, so that every statement is executed by python, "
+						"and reports the speedup.",
+					defaultValue = False,
+				),
+
+			]
+
+		)
+
+		self.parameters().userData()["parser"] = IECore.CompoundObject(
+			{
+				"flagless" : IECore.StringVectorData( [ "script" ] )
+			}
+		)
+
+	def _run( self, args ) :
+
+		fileName = os.path.abspath( args["script"].value )
+
+		nativeTimings = self.__timings( fileName, args["repeat"].value, native = True )
+		self.__write( "Native", nativeTimings )
+
+		if args["compare"].value :
+			pythonTimings = self.__timings( fileName, args["repeat"].value, native = False )
+			self.__write( "Python", pythonTimings )
+			sys.stdout.write( "\nSpeedup : %.2fx\n" % ( min( pythonTimings ) / min( nativeTimings ) ) )
+
+		return 0
+
+	def __timings( self, fileName, repeat, native ) :
+
+		originalValue = os.environ.get( "GAFFER_NATIVE_SCRIPT_EXECUTION" )
+		os.environ["GAFFER_NATIVE_SCRIPT_EXECUTION"] = "1" if native else "0"
+
+		try :
+			result = []
+			for i in range( 0, repeat ) :
+				script = Gaffer.ScriptNode()
+				script["fileName"].setValue( fileName )
+				t = time.time()
+				script.load( continueOnError = True )
+				result.append( time.time() - t )
+				# Exclude the destruction of the previous
+				# script from the next timing.
+				del script
+				gc.collect()
+		finally :
+			if originalValue is None :
+				del os.environ["GAFFER_NATIVE_SCRIPT_EXECUTION"]
+			else :
+				os.environ["GAFFER_NATIVE_SCRIPT_EXECUTION"] = originalValue
+
+		return result
+
+	def __write( self, name, timings ) :
+
+		sys.stdout.write(
+			"{name} : {min:.3f}s (min), {mean:.3f}s (mean), {max:.3f}s (max)\n".format(
+				name = name,
+				min = min( timings ),
+				mean = sum( timings ) / len( timings ),
+				max = max( timings )
+			)
+		)
+
+IECore.registerRunTimeTyped( loadBenchmark )
@@ -67,6 +67,11 @@ class GAFFER_API DependencyNode : public Node
 		/// for input or to place one in outputs as computations are always performed on the
 		/// leaf level plugs only. Implementations of this method should call the base class
 		/// implementation first.
+		///
+		/// The result must depend only on the structure of the graph - the plugs
+		/// and their connections - and not on plug values or metadata. Results are
+		/// cached during dirty propagation, and are only recomputed when plugs are
+		/// added, removed or connected.
 		/// \todo Make this protected, and add an accessor on the Plug class instead.
 		/// The general principle in effect elsewhere in Gaffer is that plugs provide
 		/// the public interface to the work done by nodes.
@@ -58,6 +58,14 @@ namespace Gaffer
 /// // outputs of the node only once, at the exit
 /// // of the scope.
 /// ```
+///
+/// The traversal of the dependency graph is also deferred
+/// until the scope exits, at which point a single combined
+/// traversal is made from all the plugs that were edited.
+/// This makes the scope suitable for bulk edits, such as
+/// the scripted setup of many nodes, where it is
+/// considerably faster than making the edits individually.
+/// The scope is available in Python as a context manager.
 class GAFFER_API DirtyPropagationScope : boost::noncopyable
 {
 
@@ -226,6 +226,10 @@ class GAFFER_API Plug : public GraphComponent
 
 		static void pushDirtyPropagationScope();
 		static void popDirtyPropagationScope();
+		// Propagates any dirtiness that has been deferred by the
+		// current DirtyPropagationScope. Called before the graph
+		// is rewired.
+		static void flushDirtyPropagationScope();
 		// DirtyPropagationScope allowed friendship, as we use
 		// it to declare an exception-safe public interface to
 		// the two private methods above.
@@ -48,6 +48,7 @@
 
 #include <functional>
 #include <stack>
+#include <vector>
 
 namespace GafferModule
 {
@@ -203,6 +204,14 @@ class GAFFER_API ScriptNode : public Node
 		/// See execute() for a description of the continueOnError argument
 		/// and the return value.
 		bool load( bool continueOnError = false );
+		/// Loads only the named top level nodes from the script specified in
+		/// the filename plug, along with the nodes they depend on via connections
+		/// and expressions. All other nodes - including any References they
+		/// contain - are skipped entirely, so that batch processes which
+		/// need only a small part of a large script don't pay to load all of it.
+		/// Since the result is incomplete, `save()` will throw for a partially
+		/// loaded script.
+		bool load( const std::vector<std::string> &nodeNames, bool continueOnError = false );
 		/// Saves the script to the file specified by the filename plug.
 		void save() const;
 		/// Imports the nodes from the specified script, adding them to
@@ -304,17 +313,23 @@ class GAFFER_API ScriptNode : public Node
 
 		std::string serialiseInternal( const Node *parent, const Set *filter ) const;
 		bool executeInternal( const std::string &serialisation, Node *parent, bool continueOnError, const std::string &context = "" );
+		bool loadInternal( const std::vector<std::string> *nodeNames, bool continueOnError );
 
 		typedef std::function<std::string ( const Node *, const Set * )> SerialiseFunction;
 		typedef std::function<bool ( ScriptNode *, const std::string &, Node *, bool, const std::string &context )> ExecuteFunction;
+		typedef std::function<std::string ( const std::string &, const std::vector<std::string> & )> FilterFunction;
 
 		// Actual implementations reside in libGafferBindings (due to Python
-		// dependency), and are injected into these functions.
+		// dependency), and are injected into these functions. The filter
+		// function lives alongside the execute function because they share
+		// the parsing of the serialisation.
 		static SerialiseFunction g_serialiseFunction;
 		static ExecuteFunction g_executeFunction;
+		static FilterFunction g_filterFunction;
 		friend struct GafferModule::SerialiserRegistration;
 
 		bool m_executing;
+		bool m_partiallyLoaded;
 
 		// Context and plugs
 		// =================
@@ -42,6 +42,7 @@
 
 #include "Gaffer/CatchingSignalCombiner.h"
 #include "Gaffer/NumericPlug.h"
+#include "Gaffer/TypedPlug.h"
 
 #include "IECore/CompoundData.h"
 #include "IECore/FrameList.h"
@@ -175,6 +176,15 @@ class GAFFERDISPATCH_API Dispatcher : public Gaffer::Node
 		/// At the start of dispatch(), a directory is created under jobsDirectoryPlug + jobNamePlug
 		/// which the dispatcher writes temporary files to. This method returns the most recent created directory.
 		const std::string jobDirectory() const;
+		/// Returns the plug which enables incremental dispatch. When on, each completed
+		/// task is recorded in a database stored alongside the job directories for
+		/// the job, and subsequent dispatches skip tasks which have been completed
+		/// previously and are still up to date. A task is up to date if its hash is
+		/// unchanged, the file referenced by its `fileName` plug (if any) has not been
+		/// modified since the task completed, and all its preTasks and postTasks are
+		/// also up to date.
+		Gaffer::BoolPlug *skipUpToDateTasksPlug();
+		const Gaffer::BoolPlug *skipUpToDateTasksPlug() const;
 		//@}
 
 		/// A function which creates a Dispatcher.
@@ -211,6 +221,7 @@ class GAFFERDISPATCH_API Dispatcher : public Gaffer::Node
 	protected :
 
 		friend class TaskNode;
+		friend class TaskNode::TaskPlug;
 
 		IE_CORE_FORWARDDECLARE( TaskBatch )
 
@@ -283,6 +294,13 @@ class GAFFERDISPATCH_API Dispatcher : public Gaffer::Node
 
 		void executeAndPruneImmediateBatches( TaskBatch *batch, bool immediate = false ) const;
 
+		// Task database used to implement `skipUpToDateTasksPlug()`. Tasks
+		// are recorded by the TaskPlug when they are executed, and the
+		// Batcher uses the records to prune tasks from the dispatch. Both
+		// methods use the current context.
+		static void recordCompletedTask( const TaskNode::TaskPlug *plug );
+		static bool completedTaskIsUpToDate( const TaskNode::TaskPlug *plug, const IECore::MurmurHash &taskHash, const std::string &taskDatabase );
+
 		typedef std::map<std::string, std::pair<Creator, SetupPlugsFn> > CreatorMap;
 		static CreatorMap &creators();
 
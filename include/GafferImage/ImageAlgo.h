@@ -115,6 +115,16 @@ void parallelProcessTiles(
 	TileOrder tileOrder = Unordered
 );
 
+// Call the functor in parallel, once for each of the specified tiles.
+// Tiles are dispatched in the order given, so this may be used to
+// prioritise the processing of the most important tiles.
+template <class TileFunctor>
+void parallelProcessTiles(
+	const ImagePlug *imagePlug,
+	const std::vector<Imath::V2i> &tileOrigins,
+	TileFunctor &&functor // Signature : void functor( const ImagePlug *imagePlug, const V2i &tileOrigin )
+);
+
 // Call the functor in parallel, once per tile per channel
 template <class TileFunctor>
 void parallelProcessTiles(
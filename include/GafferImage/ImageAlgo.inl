@@ -351,6 +351,52 @@ void parallelProcessTiles( const ImagePlug *imagePlug, TileFunctor &&functor, co
 	);
 }
 
+template <class TileFunctor>
+void parallelProcessTiles( const ImagePlug *imagePlug, const std::vector<Imath::V2i> &tileOrigins, TileFunctor &&functor )
+{
+	if( tileOrigins.empty() )
+	{
+		return;
+	}
+
+	std::vector<Imath::V2i>::const_iterator tileIt = tileOrigins.begin();
+	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	parallel_pipeline( tbb::task_scheduler_init::default_num_threads(),
+
+		tbb::make_filter<void, Imath::V2i>(
+			tbb::filter::serial_in_order,
+			[ &tileIt, &tileOrigins ] ( tbb::flow_control &fc ) {
+				if( tileIt == tileOrigins.end() )
+				{
+					fc.stop();
+					return Imath::V2i();
+				}
+				return *tileIt++;
+			}
+		) &
+
+		tbb::make_filter<Imath::V2i, void>(
+
+			tbb::filter::parallel,
+
+			[ imagePlug, &functor, &threadState ] ( const Imath::V2i &tileOrigin ) {
+
+				ImagePlug::ChannelDataScope channelDataScope( threadState );
+				channelDataScope.setTileOrigin( tileOrigin );
+				functor( imagePlug, tileOrigin );
+
+			}
+
+		),
+
+		// Prevents outer tasks silently cancelling our tasks
+		taskGroupContext
+
+	);
+}
+
 template <class TileFunctor>
 void parallelProcessTiles( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, TileFunctor &&functor, const Imath::Box2i &window, TileOrder tileOrder )
 {
@@ -112,6 +112,10 @@ class GAFFERIMAGE_API ImageReader : public ImageNode
 		Gaffer::StringPlug *colorSpacePlug();
 		const Gaffer::StringPlug *colorSpacePlug() const;
 
+		/// See OpenImageIOReader::readAheadPlug().
+		Gaffer::IntPlug *readAheadPlug();
+		const Gaffer::IntPlug *readAheadPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
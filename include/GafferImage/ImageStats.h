@@ -42,10 +42,18 @@
 #include "Gaffer/BoxPlug.h"
 #include "Gaffer/CompoundNumericPlug.h"
 #include "Gaffer/ComputeNode.h"
+#include "Gaffer/NumericPlug.h"
+#include "Gaffer/TypedObjectPlug.h"
 
 namespace GafferImage
 {
 
+/// Computes statistics for a region of an image. All outputs are
+/// derived from a parallel reduction over the tiles covered by `area`,
+/// with per-tile results stored in internal plugs so that they may be
+/// cached independently. Tiles lying entirely inside the area don't
+/// depend on its exact value, so small changes to the area only require
+/// the tiles on its border to be recomputed.
 /// \todo Add an areaSource plug with the same semantics
 /// that the Crop node has.
 class GAFFERIMAGE_API ImageStats : public Gaffer::ComputeNode
@@ -78,6 +86,25 @@ class GAFFERIMAGE_API ImageStats : public Gaffer::ComputeNode
 		Gaffer::Color4fPlug *maxPlug();
 		const Gaffer::Color4fPlug *maxPlug() const;
 
+		Gaffer::IntPlug *histogramBinsPlug();
+		const Gaffer::IntPlug *histogramBinsPlug() const;
+
+		Gaffer::V2fPlug *histogramRangePlug();
+		const Gaffer::V2fPlug *histogramRangePlug() const;
+
+		Gaffer::FloatPlug *percentilePlug();
+		const Gaffer::FloatPlug *percentilePlug() const;
+
+		/// Has four IntVectorDataPlug children, named "r", "g",
+		/// "b" and "a", holding the pixel counts for each bin.
+		Gaffer::ValuePlug *histogramPlug();
+		const Gaffer::ValuePlug *histogramPlug() const;
+
+		/// Values are interpolated from the histogram, so are only
+		/// as accurate as `histogramBins` and `histogramRange` allow.
+		Gaffer::Color4fPlug *percentileValuePlug();
+		const Gaffer::Color4fPlug *percentileValuePlug() const;
+
 	protected :
 
 		/// Implemented to hash the area we are sampling along with the channel context and regionOfInterest.
@@ -86,9 +113,31 @@ class GAFFERIMAGE_API ImageStats : public Gaffer::ComputeNode
 		/// Computes the min, max and average plugs by analyzing the input ImagePlug.
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
 
+		/// Implemented to use TaskCollaboration for the plugs which
+		/// gather results from all tiles in parallel.
+		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		Gaffer::ValuePlug::CachePolicy hashCachePolicy( const Gaffer::ValuePlug *output ) const override;
+
 	private :
 
+		// Evaluated per tile and channel, with the tileOrigin and
+		// channelName context variables set as for `in.channelData`.
+		Gaffer::CompoundObjectPlug *tileStatsPlug();
+		const Gaffer::CompoundObjectPlug *tileStatsPlug() const;
+
+		Gaffer::IntVectorDataPlug *tileHistogramPlug();
+		const Gaffer::IntVectorDataPlug *tileHistogramPlug() const;
+
+		// Gathers the results of `tileStatsPlug()` for all channels.
+		Gaffer::CompoundObjectPlug *allStatsPlug();
+		const Gaffer::CompoundObjectPlug *allStatsPlug() const;
+
 		std::string channelName( int colorIndex ) const;
+		// Returns the region of the current tile which lies in both
+		// `area` and the input data window.
+		Imath::Box2i tileRegion( const Gaffer::Context *context ) const;
+		// Returns the unique valid channel names from `channels`.
+		std::vector<std::string> validChannelNames() const;
 
 		static size_t g_firstPlugIndex;
 
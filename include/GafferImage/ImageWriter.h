@@ -42,6 +42,8 @@
 
 #include "GafferDispatch/TaskNode.h"
 
+#include "Gaffer/TypedPlug.h"
+
 #include "IECore/CompoundData.h"
 
 #include <functional>
@@ -89,6 +91,11 @@ class GAFFERIMAGE_API ImageWriter : public GafferDispatch::TaskNode
 		Gaffer::StringPlug *colorSpacePlug();
 		const Gaffer::StringPlug *colorSpacePlug() const;
 
+		/// When on, only the part of the data window inside the
+		/// display window is computed and written.
+		Gaffer::BoolPlug *cropToFormatPlug();
+		const Gaffer::BoolPlug *cropToFormatPlug() const;
+
 		Gaffer::ValuePlug *fileFormatSettingsPlug( const std::string &fileFormat );
 		const Gaffer::ValuePlug *fileFormatSettingsPlug( const std::string &fileFormat ) const;
 
@@ -82,10 +82,50 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 		Gaffer::IntVectorDataPlug *availableFramesPlug();
 		const Gaffer::IntVectorDataPlug *availableFramesPlug() const;
 
+		/// The number of tile batches to read asynchronously
+		/// ahead of the batch currently being read. This can
+		/// hide I/O latency when images are accessed in order,
+		/// as they are by the ImageWriter. Zero disables read-ahead.
+		Gaffer::IntPlug *readAheadPlug();
+		const Gaffer::IntPlug *readAheadPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
+		/// Controls the number of threads used to perform read-ahead.
+		/// These are shared by all readers. Setting zero disables
+		/// read-ahead entirely.
+		static void setReadAheadThreads( size_t numThreads );
+		static size_t getReadAheadThreads();
+
+		/// Limits the memory used to hold tile batches that have been
+		/// read ahead but not yet requested. The limit applies to all
+		/// readers together. Read-ahead is skipped while the limit is
+		/// reached.
+		static void setReadAheadMemoryLimit( size_t bytes );
+		static size_t getReadAheadMemoryLimit();
+		/// Returns the memory currently used by read-ahead.
+		static size_t readAheadMemoryUsage();
+
+		/// Counts of read-ahead activity across all readers,
+		/// intended for testing and diagnostics.
+		struct ReadAheadStatistics
+		{
+			ReadAheadStatistics() : reads( 0 ), batchesRead( 0 ), batchesUsed( 0 ) {}
+			/// The number of file reads performed by read-ahead.
+			size_t reads;
+			/// The number of tile batches fetched by those reads.
+			/// Several batches may be fetched by a single read.
+			size_t batchesRead;
+			/// The number of tile batches that were taken from
+			/// read-ahead rather than being read on demand.
+			size_t batchesUsed;
+		};
+
+		static ReadAheadStatistics readAheadStatistics();
+		static void resetReadAheadStatistics();
+
 	protected :
 
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
@@ -43,9 +43,13 @@
 #include "Gaffer/StringPlug.h"
 #include "Gaffer/TypedObjectPlug.h"
 
+#include <vector>
+
 namespace GafferImage
 {
 
+class Sampler;
+
 class GAFFERIMAGE_API RankFilter : public ImageProcessor
 {
 
@@ -98,6 +102,13 @@ class GAFFERIMAGE_API RankFilter : public ImageProcessor
 		Gaffer::V2iVectorDataPlug *pixelOffsetsPlug();
 		const Gaffer::V2iVectorDataPlug *pixelOffsetsPlug() const;
 
+		// Computes the rank value for every pixel in the tile using sliding
+		// window algorithms, whose cost grows linearly with the radius rather
+		// than quadratically. The input pixels are also returned, for use in
+		// locating the rank. Returns false if the input contains NaNs, in which
+		// case the brute force approach must be used instead.
+		bool slidingWindowRanks( Sampler &sampler, const Imath::Box2i &inputBound, const Imath::V2i &radius, std::vector<float> &inputPixels, std::vector<float> &ranks, const Gaffer::Context *context ) const;
+
 		static size_t g_firstPlugIndex;
 		int m_mode;
 };
@@ -93,6 +93,9 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 		IE_CORE_DECLARERUNTIMETYPEDEXTENSION( GafferImageUI::ImageGadget, ImageGadgetTypeId, Gadget );
 
 		Imath::Box3f bound() const override;
+		/// Returns an infinite bound, because tiles are
+		/// updated and drawn asynchronously during rendering.
+		Imath::Box3f renderBound() const override;
 
 		void setImage( GafferImage::ConstImagePlugPtr image );
 		const GafferImage::ImagePlug *getImage() const;
@@ -233,6 +236,10 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 			// such that they become visible to the UI thread together.
 			static void applyUpdates( const std::vector<Update> &updates );
 
+			// Called from the UI thread. Converts the channel data
+			// from the most recent update into a texture, returning
+			// false if there was nothing to convert.
+			bool updateTexture();
 			// Called from the UI thread.
 			const IECoreGL::Texture *texture( bool &active );
 
@@ -254,17 +261,47 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 		friend size_t tbb_hasher( const ImageGadget::TileIndex &tileIndex );
 
 		// Tile update. We update tiles asynchronously from background
-		// threads.
+		// threads. Only tiles within the region visible in the viewport
+		// are updated, and tiles outside it are never hashed or computed.
+		// When panning or zooming brings new tiles into view, we launch
+		// a fresh update for the new region. Tiles are computed in order
+		// of priority, so that the centre of the view fills in first.
 
 		void updateTiles();
 		void removeOutOfBoundsTiles() const;
+		// Returns the bound of the image visible in the viewport, in
+		// pixel space. Returns an empty box if there is no viewport.
+		Imath::Box2f visibleBound() const;
+		// Returns the part of the data window visible in the viewport,
+		// padded by a tile on each side so that small pans don't
+		// require an update.
+		Imath::Box2i visibleRegion() const;
+		// Returns the origins of the tiles in `region`, ordered so that
+		// tiles within `visibleBound()` come first, and closer tiles
+		// come before more distant ones. The result is cached until
+		// the region or view change, so that it may be called every
+		// redraw without resorting the tiles.
+		const std::vector<Imath::V2i> &prioritisedTileOrigins( const Imath::Box2i &region ) const;
+		// Requests a render from the UI thread. May be called
+		// from any thread.
+		void requestRenderOnUIThread();
 
 		std::unique_ptr<Gaffer::BackgroundTask> m_tilesTask;
+		// The region covered by the most recent update.
+		Imath::Box2i m_tilesRegion;
+		// Cache for `prioritisedTileOrigins()`.
+		mutable Imath::Box2i m_prioritisedTilesRegion;
+		mutable Imath::Box2f m_prioritisedVisibleBound;
+		mutable std::vector<Imath::V2i> m_prioritisedTileOrigins;
 		std::atomic_bool m_renderRequestPending;
 
 		// Rendering.
 
 		void visibilityChanged();
+		// Converts new tile data into textures, in order of priority,
+		// limiting the time spent so that the UI remains responsive.
+		// Returns false if there are tiles remaining to be converted.
+		bool updateTextures( const Imath::Box2i &region ) const;
 		void renderTiles() const;
 		void renderText( const std::string &text, const Imath::V2f &position, const Imath::V2f &alignment, const GafferUI::Style *style ) const;
 
@@ -140,6 +140,9 @@ class GAFFERSCENEUI_API SceneGadget : public GafferUI::Gadget
 		/// waiting for it.
 
 		Imath::Box3f bound() const override;
+		/// Returns an infinite bound, because `bound()` is
+		/// only updated as the scene is updated during rendering.
+		Imath::Box3f renderBound() const override;
 
 		/// Specifies which object types are selectable via `objectAt()` and `objectsAt()`.
 		/// May be null, which means all object types are selectable. A copy of `typeNames`
@@ -172,6 +175,8 @@ class GAFFERSCENEUI_API SceneGadget : public GafferUI::Gadget
 	private :
 
 		void updateRenderer();
+		// Requests a render from the UI thread.
+		void requestRenderOnUIThread();
 		void renderScene() const;
 		IECore::PathMatcher convertSelection( IECore::UIntVectorDataPtr ids ) const;
 		void visibilityChanged();
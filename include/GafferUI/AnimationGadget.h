@@ -76,6 +76,10 @@ class GAFFERUI_API AnimationGadget : public Gadget
 
 		std::string getToolTip( const IECore::LineSegment3f &line ) const override;
 
+		/// Returns an infinite bound, since we draw the curves,
+		/// grid and frame indicator across the whole viewport.
+		Imath::Box3f renderBound() const override;
+
 	protected :
 
 		void doRenderLayer( Layer layer, const Style *style ) const override;
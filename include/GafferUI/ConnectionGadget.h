@@ -39,6 +39,7 @@
 #define GAFFERUI_CONNECTIONGADGET_H
 
 #include "GafferUI/ConnectionCreator.h"
+#include "GafferUI/Style.h"
 
 #include "Gaffer/Plug.h"
 
@@ -96,6 +97,15 @@ class GAFFERUI_API ConnectionGadget : public ConnectionCreator
 		/// Used for snapping new dots onto an existing connection
 		virtual Imath::V3f closestPoint( const Imath::V3f &p ) const = 0;
 
+		/// Used by the GraphGadget to draw all connections in a single batch
+		/// when it is zoomed out too far for their details to be visible (see
+		/// `GraphGadget::lowDetail()`). Implementations should either return false,
+		/// in which case the connection is rendered by doRenderLayer() as usual, or
+		/// fill in the arguments to describe a straight line and return true, in which
+		/// case doRenderLayer() should draw nothing while `lowDetail()` is true and
+		/// selection is not being performed. The default implementation returns false.
+		virtual bool lowDetailLine( Imath::V3f &srcPosition, Imath::V3f &dstPosition, Style::State &state, const Imath::Color3f *&userColor ) const;
+
 		/// Creates a ConnectionGadget to represent the connection between the two
 		/// specified Nodules.
 		static ConnectionGadgetPtr create( NodulePtr srcNodule, NodulePtr dstNodule );
@@ -190,6 +190,15 @@ class GAFFERUI_API Gadget : public Gaffer::GraphComponent
 		/// implementation returns the union of the transformed bounding boxes
 		/// of all the children.
 		virtual Imath::Box3f bound() const;
+		/// The bounding box used to cull the Gadget during rendering, in the
+		/// same space as `bound()`. Gadgets are not rendered when this lies
+		/// entirely outside the viewport. The default implementation returns
+		/// the union of `bound()` and the transformed render bounds of all the
+		/// children, and is infinite if any child's render bound is infinite.
+		/// Derived classes which draw outside their bound should extend the
+		/// result, or return an infinite box to disable culling entirely.
+		/// Culling is also disabled for empty bounds.
+		virtual Imath::Box3f renderBound() const;
 		/// The bounding box transformed by the result of getTransform().
 		Imath::Box3f transformedBound() const;
 		/// The bounding box transformed by the result of fullTransform( ancestor ).
@@ -296,7 +305,12 @@ class GAFFERUI_API Gadget : public Gaffer::GraphComponent
 
 		// Sets the GL state up with the name attribute and transform for
 		// this Gadget, makes sure the style is bound and then calls doRenderLayer().
-		void renderLayer( Layer layer, const Style *currentStyle = nullptr ) const;
+		// Children whose `renderBound()` is outside the clip space defined by
+		// `parentToClip` are not rendered.
+		void renderLayer( Layer layer, const Style *currentStyle, const Imath::M44f &parentToClip ) const;
+		// Returns `renderBound()`, caching the result for the remainder
+		// of the current call to `render()`.
+		Imath::Box3f cachedRenderBound() const;
 
 		void styleChanged();
 		void emitDescendantVisibilityChanged();
@@ -309,6 +323,9 @@ class GAFFERUI_API Gadget : public Gaffer::GraphComponent
 
 		Imath::M44f m_transform;
 
+		mutable Imath::Box3f m_renderBound;
+		mutable size_t m_renderBoundGeneration;
+
 		VisibilityChangedSignal m_visibilityChangedSignal;
 		RenderRequestSignal m_renderRequestSignal;
 
@@ -43,6 +43,8 @@
 #include "Gaffer/CompoundNumericPlug.h"
 #include "Gaffer/Plug.h"
 
+#include <chrono>
+
 namespace Gaffer
 {
 IE_CORE_FORWARDDECLARE( Node );
@@ -187,8 +189,21 @@ class GAFFERUI_API GraphGadget : public ContainerGadget
 		/// Returns the connectionGadget under the specified line.
 		ConnectionGadget *connectionGadgetAt( const IECore::LineSegment3f &lineInGadgetSpace ) const;
 
+		/// Returns true if the graph is zoomed out so far that node labels
+		/// and nodules would be illegible. In this case NodeGadgets are drawn
+		/// as plain boxes, and connections are drawn as straight lines in a
+		/// single batch (see `ConnectionGadget::lowDetailLine()`). This is
+		/// updated whenever the camera or viewport of the ancestor
+		/// ViewportGadget changes, and at the start of each render.
+		bool lowDetail() const;
+
+		/// Returns an infinite bound, since we draw the drag
+		/// selection region in addition to our children.
+		Imath::Box3f renderBound() const override;
+
 	protected :
 
+		void parentChanged( Gaffer::GraphComponent *oldParent ) override;
 		void doRenderLayer( Layer layer, const Style *style ) const override;
 
 	private :
@@ -244,6 +259,10 @@ class GAFFERUI_API GraphGadget : public ContainerGadget
 		ConnectionGadget *reconnectionGadgetAt( const NodeGadget *gadget, const IECore::LineSegment3f &lineInGadgetSpace ) const;
 		void updateDragReconnectCandidate( const DragDropEvent &event );
 
+		void updateLowDetail() const;
+		void renderLowDetailConnections( const Style *style ) const;
+		void renderFrameTime( const Style *style ) const;
+
 		void connectedNodeGadgetsWalk( NodeGadget *gadget, std::set<NodeGadget *> &connectedGadgets, Gaffer::Plug::Direction direction, size_t degreesOfSeparation );
 
 		Gaffer::NodePtr m_root;
@@ -291,6 +310,11 @@ class GAFFERUI_API GraphGadget : public ContainerGadget
 
 		GraphLayoutPtr m_layout;
 
+		mutable bool m_lowDetail;
+		boost::signals::scoped_connection m_viewportChangedConnection;
+		boost::signals::scoped_connection m_cameraChangedConnection;
+		mutable std::chrono::steady_clock::time_point m_renderStartTime;
+
 };
 
 IE_CORE_DECLAREPTR( GraphGadget );
@@ -62,6 +62,9 @@ class GAFFERUI_API Handle : public Gadget
 		bool getVisibleOnHover() const;
 
 		Imath::Box3f bound() const override;
+		/// Returns an infinite bound, since the raster scale
+		/// means we may be drawn outside of `bound()`.
+		Imath::Box3f renderBound() const override;
 
 	protected :
 
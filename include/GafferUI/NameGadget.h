@@ -54,6 +54,12 @@ class GAFFERUI_API NameGadget : public TextGadget
 
 		IE_CORE_DECLARERUNTIMETYPEDEXTENSION( GafferUI::NameGadget, NameGadgetTypeId, TextGadget );
 
+	protected :
+
+		// Implemented to omit the name when the GraphGadget
+		// is zoomed out too far for it to be legible.
+		void doRenderLayer( Layer layer, const Style *style ) const override;
+
 	private :
 
 		void nameChanged( Gaffer::GraphComponentPtr object );
@@ -62,6 +62,9 @@ class GAFFERUI_API StandardConnectionGadget : public ConnectionGadget
 		IE_CORE_DECLARERUNTIMETYPEDEXTENSION( GafferUI::StandardConnectionGadget, StandardConnectionGadgetTypeId, ConnectionGadget );
 
 		Imath::Box3f bound() const override;
+		/// Extends `bound()` to account for the curvature of the
+		/// connection and for the previews drawn while dragging.
+		Imath::Box3f renderBound() const override;
 
 		void setNodules( GafferUI::NodulePtr srcNodule, GafferUI::NodulePtr dstNodule ) override;
 
@@ -70,6 +73,7 @@ class GAFFERUI_API StandardConnectionGadget : public ConnectionGadget
 		void createConnection( Gaffer::Plug *endpoint ) override;
 
 		Imath::V3f closestPoint( const Imath::V3f &p ) const override;
+		bool lowDetailLine( Imath::V3f &srcPosition, Imath::V3f &dstPosition, Style::State &state, const Imath::Color3f *&userColor ) const override;
 
 		std::string getToolTip( const IECore::LineSegment3f &line ) const override;
 
@@ -94,6 +98,11 @@ class GAFFERUI_API StandardConnectionGadget : public ConnectionGadget
 		// connection is not minimised. This method returns them
 		// adjusted according to `getMinimised().
 		void minimisedPositionAndTangent( bool highlighted, Imath::V3f &position, Imath::V3f &tangent ) const;
+		// Returns true if we can currently be represented by
+		// `lowDetailLine()`. We don't simplify auxiliary connections
+		// because they have a distinctive style of their own, and we
+		// always want to show the full detail of any interaction.
+		bool lowDetailCompatible() const;
 		// Updates m_srcPos, m_srcTangent etc. We basically always
 		// call this before accessing that state, so I'm not sure
 		// why we store it at all - we could just return it instead.
@@ -100,6 +100,9 @@ class GAFFERUI_API StandardNodeGadget : public NodeGadget
 		bool getLabelsVisibleOnHover() const;
 
 		Imath::Box3f bound() const override;
+		/// Includes the full extent of the frame, nodules and
+		/// error indicator, which `bound()` deliberately omits.
+		Imath::Box3f renderBound() const override;
 
 	protected :
 
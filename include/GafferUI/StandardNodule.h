@@ -70,6 +70,8 @@ class GAFFERUI_API StandardNodule : public Nodule
 		void createConnection( Gaffer::Plug *destinationPlug ) override;
 
 		Imath::Box3f bound() const override;
+		/// Includes the connection being dragged, if any.
+		Imath::Box3f renderBound() const override;
 
 	protected :
 
@@ -53,6 +53,8 @@ IECORE_POP_DEFAULT_VISIBILITY
 
 #include "boost/signal.hpp"
 
+#include <vector>
+
 namespace IECoreGL
 {
 
@@ -130,6 +132,14 @@ class GAFFERUI_API Style : public IECore::RunTimeTyped
 		virtual void renderNodule( float radius, State state = NormalState, const Imath::Color3f *userColor = nullptr ) const = 0;
 		/// The tangents give an indication of which direction is "out" from a node.
 		virtual void renderConnection( const Imath::V3f &srcPosition, const Imath::V3f &srcTangent, const Imath::V3f &dstPosition, const Imath::V3f &dstTangent, State state = NormalState, const Imath::Color3f *userColor = nullptr ) const = 0;
+		/// Renders many connections at once as straight lines, without the curvature
+		/// or width provided by renderConnection(). This is much cheaper, and is intended
+		/// for use when the graph is zoomed out so far that the difference is imperceptible.
+		/// Each consecutive pair of positions defines a single connection. The default
+		/// implementation calls renderConnection() for each pair, with tangents that
+		/// make the connections straight. Derived classes should reimplement it to
+		/// draw all the connections in a single batch.
+		virtual void renderLowDetailConnections( const std::vector<Imath::V3f> &positions, State state = NormalState, const Imath::Color3f *userColor = nullptr ) const;
 		virtual Imath::V3f closestPointOnConnection( const Imath::V3f &p, const Imath::V3f &srcPosition, const Imath::V3f &srcTangent, const Imath::V3f &dstPosition, const Imath::V3f &dstTangent ) const = 0;
 		virtual void renderAuxiliaryConnection( const Imath::Box2f &srcNodeFrame, const Imath::Box2f &dstNodeFrame, State state ) const = 0;
 		virtual void renderAuxiliaryConnection( const Imath::V2f &srcPosition, const Imath::V2f &srcTangent, const Imath::V2f &dstPosition, const Imath::V2f &dstTangent, State state ) const = 0;
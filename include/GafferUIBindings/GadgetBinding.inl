@@ -57,6 +57,13 @@ static Imath::Box3f bound( const T &p )
 	return p.T::bound();
 }
 
+template<typename T>
+static Imath::Box3f renderBound( const T &p )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return p.T::renderBound();
+}
+
 template<typename T>
 static std::string getToolTip( const T &p, const IECore::LineSegment3f &line )
 {
@@ -72,6 +79,7 @@ GadgetClass<T, TWrapper>::GadgetClass( const char *docString )
 {
 	this->def( "setHighlighted", &Detail::setHighlighted<T> );
 	this->def( "bound", &Detail::bound<T> );
+	this->def( "renderBound", &Detail::renderBound<T> );
 	this->def( "getToolTip", &Detail::getToolTip<T> );
 }
 
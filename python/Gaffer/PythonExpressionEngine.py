@@ -35,6 +35,7 @@
 #
 ##########################################################################
 
+import os
 import re
 import ast
 import functools
@@ -55,7 +56,9 @@ class PythonExpressionEngine( Gaffer.Expression.Engine ) :
 
 		parser = _Parser( expression )
 
-		self.__expression = expression
+		# Compile once up front, rather than every time
+		# we execute.
+		self.__code = compile( expression, "<string>", "exec" )
 		self.__inPlugPaths = list( parser.plugReads )
 		self.__outPlugPaths = list( parser.plugWrites )
 
@@ -63,6 +66,16 @@ class PythonExpressionEngine( Gaffer.Expression.Engine ) :
 		outPlugs.extend( [ self.__plug( node, p ) for p in self.__outPlugPaths ] )
 		contextNames.extend( parser.contextReads )
 
+		# If the expression is simple enough, translate it so that it
+		# can be executed natively, without the need to acquire the GIL.
+		# Any expression that can't be executed natively (or which fails
+		# during native execution) falls back to being executed by python.
+		if os.environ.get( "GAFFER_NATIVE_PYTHON_EXPRESSIONS", "1" ) != "0" :
+			self._setNativeProgram(
+				_nativeProgram( parser.module, self.__inPlugPaths, self.__outPlugPaths ),
+				len( self.__outPlugPaths )
+			)
+
 	def execute( self, context, inputs ) :
 
 		plugDict = {}
@@ -85,7 +98,7 @@ class PythonExpressionEngine( Gaffer.Expression.Engine ) :
 
 		executionDict = { "imath" : imath, "IECore" : IECore, "parent" : plugDict, "context" : _ContextProxy( context ) }
 
-		exec( self.__expression, executionDict, executionDict )
+		exec( self.__code, executionDict, executionDict )
 
 		result = IECore.ObjectVector()
 		for plugPath in self.__outPlugPaths :
@@ -231,13 +244,14 @@ class _Parser( ast.NodeVisitor ) :
 		self.plugReads = set()
 		self.contextReads = set()
 
-		self.visit( ast.parse( expression ) )
+		self.module = ast.parse( expression )
+		self.visit( self.module )
 
 	def visit_Assign( self, node ) :
 
 		if len( node.targets ) == 1 :
 			if isinstance( node.targets[0], ast.Subscript ) :
-				plugPath = self.__plugPath( self.__path( node.targets[0] ) )
+				plugPath = _plugPath( _path( node.targets[0] ) )
 				if plugPath :
 					self.plugWrites.add( plugPath )
 
@@ -246,12 +260,12 @@ class _Parser( ast.NodeVisitor ) :
 	def visit_Subscript( self, node ) :
 
 		if isinstance( node.ctx, ast.Load ) :
-			path = self.__path( node )
-			plugPath = self.__plugPath( path )
+			path = _path( node )
+			plugPath = _plugPath( path )
 			if plugPath :
 				self.plugReads.add( plugPath )
 			else :
-				contextName = self.__contextName( path )
+				contextName = _contextName( path )
 				if contextName :
 					self.contextReads.add( contextName )
 
@@ -295,38 +309,120 @@ class _Parser( ast.NodeVisitor ) :
 
 		self.contextReads.add( node.left.s )
 
-	def __path( self, node ) :
-
-		result = []
-		while node is not None :
-			if isinstance( node, ast.Subscript ) :
-				if isinstance( node.slice, ast.Index ) :
-					if isinstance( node.slice.value, ast.Str ) :
-						result.insert( 0, node.slice.value.s )
-					else :
-						return []
-				node = node.value
-			elif isinstance( node, ast.Name ) :
-				result.insert( 0, node.id )
-				node = None
-			else :
-				return []
+def _path( node ) :
 
-		return result
+	result = []
+	while node is not None :
+		if isinstance( node, ast.Subscript ) :
+			if isinstance( node.slice, ast.Index ) :
+				if isinstance( node.slice.value, ast.Str ) :
+					result.insert( 0, node.slice.value.s )
+				else :
+					return []
+			node = node.value
+		elif isinstance( node, ast.Name ) :
+			result.insert( 0, node.id )
+			node = None
+		else :
+			return []
 
-	def __plugPath( self, path ) :
+	return result
 
-		if len( path ) < 2 or path[0] != "parent" :
-			return ""
-		else :
-			return ".".join( path[1:] )
+def _plugPath( path ) :
+
+	if len( path ) < 2 or path[0] != "parent" :
+		return ""
+	else :
+		return ".".join( path[1:] )
 
-	def __contextName( self, path ) :
+def _contextName( path ) :
 
-		if len( path ) !=2 or path[0] != "context" :
-			return ""
+	if len( path ) !=2 or path[0] != "context" :
+		return ""
+	else :
+		return path[1]
+
+##########################################################################
+# Native translation. Expressions consisting only of assignments of
+# simple arithmetic to output plugs are translated into a list of
+# instructions for a stack machine, which is evaluated natively by
+# `Expression.Engine`. This allows the most common expressions to be
+# executed without acquiring the GIL.
+##########################################################################
+
+class _NotNative( Exception ) :
+
+	pass
+
+def _nativeProgram( module, inPlugPaths, outPlugPaths ) :
+
+	program = []
+	try :
+		for statement in module.body :
+			if not isinstance( statement, ast.Assign ) or len( statement.targets ) != 1 :
+				raise _NotNative()
+			outPlugPath = _plugPath( _path( statement.targets[0] ) )
+			if outPlugPath not in outPlugPaths or outPlugPath in inPlugPaths :
+				raise _NotNative()
+			__nativeInstructions( statement.value, inPlugPaths, program )
+			program.append( ( "store", outPlugPaths.index( outPlugPath ) ) )
+	except _NotNative :
+		return None
+
+	return program
+
+__nativeBinaryOps = {
+	ast.Add : "add",
+	ast.Sub : "subtract",
+	ast.Mult : "multiply",
+	ast.Div : "divide",
+}
+
+__nativeContextMethods = {
+	"getFrame" : "frame",
+	"getTime" : "time",
+	"getFramesPerSecond" : "framesPerSecond",
+}
+
+def __nativeInstructions( node, inPlugPaths, program ) :
+
+	if isinstance( node, ast.Num ) and type( node.n ) in ( int, float ) :
+		program.append( ( "constant", node.n ) )
+	elif isinstance( node, ast.Name ) and node.id in ( "True", "False" ) :
+		program.append( ( "constant", node.id == "True" ) )
+	elif isinstance( node, ast.Subscript ) :
+		path = _path( node )
+		plugPath = _plugPath( path )
+		contextName = _contextName( path )
+		if plugPath in inPlugPaths :
+			program.append( ( "plug", inPlugPaths.index( plugPath ) ) )
+		elif contextName :
+			program.append( ( "context", str( contextName ) ) )
+		else :
+			raise _NotNative()
+	elif isinstance( node, ast.Call ) :
+		if (
+			not isinstance( node.func, ast.Attribute ) or
+			not isinstance( node.func.value, ast.Name ) or
+			node.func.value.id != "context" or
+			node.keywords or node.starargs or node.kwargs
+		) :
+			raise _NotNative()
+		if node.func.attr in __nativeContextMethods and not node.args :
+			program.append( ( __nativeContextMethods[node.func.attr], ) )
+		elif node.func.attr == "get" and len( node.args ) == 1 and isinstance( node.args[0], ast.Str ) :
+			program.append( ( "context", str( node.args[0].s ) ) )
 		else :
-			return path[1]
+			raise _NotNative()
+	elif isinstance( node, ast.BinOp ) and type( node.op ) in __nativeBinaryOps :
+		__nativeInstructions( node.left, inPlugPaths, program )
+		__nativeInstructions( node.right, inPlugPaths, program )
+		program.append( ( __nativeBinaryOps[type( node.op )], ) )
+	elif isinstance( node, ast.UnaryOp ) and isinstance( node.op, ast.USub ) :
+		__nativeInstructions( node.operand, inPlugPaths, program )
+		program.append( ( "negate", ) )
+	else :
+		raise _NotNative()
 
 ##########################################################################
 # Functions for setting plug values.
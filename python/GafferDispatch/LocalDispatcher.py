@@ -36,6 +36,8 @@
 
 import os
 import errno
+import json
+import select
 import signal
 import shlex
 import subprocess32 as subprocess
@@ -56,7 +58,12 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 		self["executeInBackground"] = Gaffer.BoolPlug( defaultValue = False )
 		self["ignoreScriptLoadErrors"] = Gaffer.BoolPlug( defaultValue = False )
+		self["partialLoad"] = Gaffer.BoolPlug( defaultValue = False )
 		self["environmentCommand"] = Gaffer.StringPlug()
+		self["slots"] = Gaffer.IntPlug( defaultValue = 1, minValue = 1 )
+		self["threads"] = Gaffer.IntPlug( defaultValue = 0, minValue = 0 )
+		self["memory"] = Gaffer.FloatPlug( defaultValue = 0, minValue = 0 )
+		self["persistentWorkers"] = Gaffer.BoolPlug( defaultValue = False )
 
 		self.__jobPool = jobPool if jobPool else LocalDispatcher.defaultJobPool()
 
@@ -87,6 +94,12 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			self.__id = os.path.basename( self.__directory )
 			self.__stats = {}
 			self.__ignoreScriptLoadErrors = dispatcher["ignoreScriptLoadErrors"].getValue()
+			self.__partialLoad = dispatcher["partialLoad"].getValue()
+			self.__slots = dispatcher["slots"].getValue()
+			self.__threads = dispatcher["threads"].getValue() or IECore.hardwareConcurrency()
+			self.__memory = dispatcher["memory"].getValue() or self.__physicalMemory()
+			self.__persistentWorkers = dispatcher["persistentWorkers"].getValue()
+			self.__idleWorkers = []
 			## \todo Make `Dispatcher::dispatch()` use a Process, so we don't need to
 			# do substitutions manually like this.
 			self.__environmentCommand = Gaffer.Context.current().substitute(
@@ -130,10 +143,17 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			pcpu = 0.0
 			pid = batch.blindData().get( "pid" )
 
+			# Accumulate statistics for all the batches that are running
+			# concurrently, not just the current one.
+			pids = set(
+				str( b.blindData()["pid"] ) for b in self.__orderedBatches( self.__batch )
+				if self.__getStatus( b ) == LocalDispatcher.Job.Status.Running and "pid" in b.blindData()
+			)
+
 			try :
 				stats = subprocess.Popen( ( "ps -Ao pid,ppid,pgid,sess,pcpu,rss" ).split( " " ), stdout=subprocess.PIPE, stderr=subprocess.PIPE ).communicate()[0].split()
 				for i in range( 0, len(stats), 6 ) :
-					if str(pid) in stats[i:i+4] :
+					if pids.intersection( stats[i:i+4] ) :
 						pcpu += float(stats[i+4])
 						rss += float(stats[i+5])
 			except :
@@ -224,79 +244,306 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 		def __backgroundDispatch( self ) :
 
 			with self.__messageHandler :
-				self.__doBackgroundDispatch( self.__batch )
-
+				try :
+					self.__doBackgroundDispatch( self.__batch )
+				finally :
+					self.__shutdownWorkers()
+
+		# Executes all the batches upstream of `batch`, running independent
+		# batches concurrently in separate processes. Each batch occupies
+		# one or more of the available slots, along with any threads and
+		# memory it has declared that it needs. Batches are launched in the
+		# order a serial depth-first walk would visit them, as soon as their
+		# preTasks are complete and there are enough free resources.
 		def __doBackgroundDispatch( self, batch ) :
 
-			if self.__getStatus( batch ) == LocalDispatcher.Job.Status.Complete :
-				return True
+			waiting = [ b for b in self.__orderedBatches( batch ) if self.__getStatus( b ) == LocalDispatcher.Job.Status.Waiting ]
+			running = {} # Maps from batch to process
+			inUse = LocalDispatcher.Job._Resources( 0, 0, 0 )
 
-			for upstreamBatch in batch.preTasks() :
-				if not self.__doBackgroundDispatch( upstreamBatch ) :
+			while True :
+
+				changed = False
+
+				# Reap any processes that have finished.
+
+				failedBatch = None
+				for runningBatch, process in list( running.items() ) :
+
+					if process.poll() is None :
+						continue
+
+					del running[runningBatch]
+					inUse = inUse - self.__batchResources( runningBatch )
+					changed = True
+
+					if isinstance( process, LocalDispatcher.Job._Worker ) :
+						self.__releaseWorker( process )
+
+					if process.returncode :
+						if failedBatch is None :
+							failedBatch = runningBatch
+						else :
+							self.__setStatus( runningBatch, LocalDispatcher.Job.Status.Failed )
+					else :
+						self.__setStatus( runningBatch, LocalDispatcher.Job.Status.Complete )
+
+				if failedBatch is not None :
+					# Stop any other batches that are still running, so
+					# that a failed job has no processes left behind.
+					self.__terminate( running )
+					self.__reportFailed( failedBatch )
 					return False
 
-			if batch.blindData().get( "killed" ) :
-				self.__reportKilled( batch )
-				return False
+				if batch.blindData().get( "killed" ) :
+					self.__terminate( running )
+					self.__reportKilled( next( iter( running ), batch ) )
+					return False
 
-			if not batch.plug() :
-				self.__reportCompleted( batch )
-				return True
+				# Launch any batches that are ready to run.
 
-			if len( batch.frames() ) == 0 :
-				# This case occurs for nodes like TaskList and TaskContextProcessors,
-				# because they don't do anything in execute (they have empty hashes).
-				# Their batches exist only to depend on upstream batches. We don't need
-				# to do any work here, but we still signal completion for the task to
-				# provide progress feedback to the user.
-				self.__setStatus( batch, LocalDispatcher.Job.Status.Complete )
-				IECore.msg( IECore.MessageHandler.Level.Info, self.__messageTitle, "Finished " + batch.blindData()["nodeName"].value )
-				return True
+				for readyBatch in list( waiting ) :
 
-			taskContext = batch.context()
-			frames = str( IECore.frameListFromList( [ int(x) for x in batch.frames() ] ) )
+					if any( self.__getStatus( b ) != LocalDispatcher.Job.Status.Complete for b in readyBatch.preTasks() ) :
+						continue
 
-			args = [
-				"gaffer", "execute",
-				"-script", self.__scriptFile,
-				"-nodes", batch.blindData()["nodeName"].value,
-				"-frames", frames,
-			]
+					if not readyBatch.plug() :
+						waiting.remove( readyBatch )
+						self.__reportCompleted( readyBatch )
+						changed = True
+						continue
 
-			args = shlex.split( self.__environmentCommand ) + args
+					if len( readyBatch.frames() ) == 0 :
+						# This case occurs for nodes like TaskList and TaskContextProcessors,
+						# because they don't do anything in execute (they have empty hashes).
+						# Their batches exist only to depend on upstream batches. We don't need
+						# to do any work here, but we still signal completion for the task to
+						# provide progress feedback to the user.
+						waiting.remove( readyBatch )
+						self.__setStatus( readyBatch, LocalDispatcher.Job.Status.Complete )
+						IECore.msg( IECore.MessageHandler.Level.Info, self.__messageTitle, "Finished " + readyBatch.blindData()["nodeName"].value )
+						changed = True
+						continue
 
-			if self.__ignoreScriptLoadErrors :
-				args.append( "-ignoreScriptLoadErrors" )
+					resources = self.__batchResources( readyBatch )
+					if not ( inUse + resources ).fits( self.__slots, self.__threads, self.__memory ) :
+						# Wait for resources to become free, rather than letting
+						# later batches jump the queue and starve this one.
+						break
+
+					waiting.remove( readyBatch )
+					running[readyBatch] = self.__launch( readyBatch )
+					inUse = inUse + resources
+					changed = True
+
+				if self.__getStatus( batch ) == LocalDispatcher.Job.Status.Complete :
+					return True
+
+				if not changed :
+					time.sleep( 0.01 )
+
+		def __launch( self, batch ) :
+
+			taskContext = batch.context()
+			frames = str( IECore.frameListFromList( [ int(x) for x in batch.frames() ] ) )
 
 			contextArgs = []
 			for entry in [ k for k in taskContext.keys() if k != "frame" and not k.startswith( "ui:" ) ] :
 				if entry not in self.__context.keys() or taskContext[entry] != self.__context[entry] :
 					contextArgs.extend( [ "-" + entry, IECore.repr( taskContext[entry] ) ] )
 
+			self.__setStatus( batch, LocalDispatcher.Job.Status.Running )
+
+			threads = batch.blindData()["threads"].value
+			if threads :
+				threads = min( threads, self.__threads )
+
+			if self.__persistentWorkers :
+				worker = self.__acquireWorker( threads )
+				IECore.msg(
+					IECore.MessageHandler.Level.Info, self.__messageTitle,
+					"Executing %s on frames %s in worker %d" % ( batch.blindData()["nodeName"].value, frames, worker.pid )
+				)
+				worker.execute( batch.blindData()["nodeName"].value, frames, contextArgs )
+				batch.blindData()["pid"] = IECore.IntData( worker.pid )
+				return worker
+
+			args = self.__executeArgs( threads ) + [
+				"-nodes", batch.blindData()["nodeName"].value,
+				"-frames", frames,
+			]
+
+			if self.__partialLoad :
+				args.append( "-partialLoad" )
+
 			if contextArgs :
 				args.extend( [ "-context" ] + contextArgs )
 
-			self.__setStatus( batch, LocalDispatcher.Job.Status.Running )
 			IECore.msg( IECore.MessageHandler.Level.Info, self.__messageTitle, " ".join( args ) )
 			process = subprocess.Popen( args, start_new_session=True )
 			batch.blindData()["pid"] = IECore.IntData( process.pid )
 
-			while process.poll() is None :
+			return process
 
-				if batch.blindData().get( "killed" ) :
+		def __executeArgs( self, threads ) :
+
+			args = shlex.split( self.__environmentCommand ) + [
+				"gaffer", "execute",
+				"-script", self.__scriptFile,
+			]
+
+			if self.__ignoreScriptLoadErrors :
+				args.append( "-ignoreScriptLoadErrors" )
+
+			if threads :
+				# Limit the TBB threads used by the process to
+				# match the threads reserved for it.
+				args.extend( [ "-threads", str( threads ) ] )
+
+			return args
+
+		def __acquireWorker( self, threads ) :
+
+			# Workers are limited to the number of threads they were
+			# launched with, so we can only reuse a worker launched
+			# with the same number of threads as we require now.
+
+			self.__idleWorkers = [ w for w in self.__idleWorkers if w.alive() ]
+			for worker in self.__idleWorkers :
+				if worker.threads == threads :
+					self.__idleWorkers.remove( worker )
+					return worker
+
+			if self.__idleWorkers :
+				# Shut down an unsuitable worker, so we don't accumulate
+				# more idle processes than we have ever run concurrently.
+				self.__idleWorkers.pop( 0 ).shutdown()
+
+			args = self.__executeArgs( threads ) + [ "-worker" ]
+			IECore.msg( IECore.MessageHandler.Level.Info, self.__messageTitle, " ".join( args ) )
+			return LocalDispatcher.Job._Worker( args, threads )
+
+		def __releaseWorker( self, worker ) :
+
+			if worker.alive() :
+				self.__idleWorkers.append( worker )
+
+		def __shutdownWorkers( self ) :
+
+			for worker in self.__idleWorkers :
+				worker.shutdown()
+
+			self.__idleWorkers = []
+
+		# A long-lived `gaffer execute -worker` process, which loads the
+		# script once and then executes batches sent to it over a pipe,
+		# keeping its caches warm in between. Provides the same `pid`,
+		# `poll()` and `returncode` members as the processes launched for
+		# individual batches, so that the two may be used interchangeably.
+		class _Worker( object ) :
+
+			def __init__( self, args, threads ) :
+
+				self.threads = threads
+				self.__process = subprocess.Popen(
+					args,
+					stdin = subprocess.PIPE, stdout = subprocess.PIPE,
+					start_new_session = True
+				)
+				self.pid = self.__process.pid
+				self.returncode = 0
+
+			def execute( self, nodeName, frames, contextArgs ) :
+
+				self.returncode = None
+				try :
+					self.__process.stdin.write(
+						json.dumps( { "nodes" : [ nodeName ], "frames" : frames, "context" : contextArgs } ) + "\n"
+					)
+					self.__process.stdin.flush()
+				except IOError :
+					# The worker has died. We report this as a failure
+					# of the batch via `poll()`.
+					self.returncode = 1
+
+			def poll( self ) :
+
+				if self.returncode is not None :
+					return self.returncode
+
+				if select.select( [ self.__process.stdout ], [], [], 0 )[0] :
+					reply = self.__process.stdout.readline()
+					self.returncode = int( reply ) if reply.strip() else 1
+				elif self.__process.poll() is not None :
+					self.returncode = 1
+
+				return self.returncode
+
+			def alive( self ) :
+
+				return self.__process.poll() is None
+
+			def shutdown( self ) :
+
+				# Closing stdin causes the worker to exit once
+				# it has finished any work in progress.
+				try :
+					self.__process.stdin.close()
+				except IOError :
+					pass
+
+		def __terminate( self, running ) :
+
+			for batch, process in running.items() :
+				try :
 					os.killpg( process.pid, signal.SIGTERM )
-					self.__reportKilled( batch )
-					return False
+				except OSError as e :
+					if e.errno != errno.ESRCH :
+						raise
+				self.__setStatus( batch, LocalDispatcher.Job.Status.Killed )
 
-				time.sleep( 0.01 )
+		# The resources required by a batch, or currently in use
+		# by a set of running batches.
+		class _Resources( object ) :
 
-			if process.returncode :
-				self.__reportFailed( batch )
-				return False
+			def __init__( self, slots, threads, memory ) :
 
-			self.__setStatus( batch, LocalDispatcher.Job.Status.Complete )
+				self.slots = slots
+				self.threads = threads
+				self.memory = memory
 
-			return True
+			def __add__( self, other ) :
+
+				return LocalDispatcher.Job._Resources( self.slots + other.slots, self.threads + other.threads, self.memory + other.memory )
+
+			def __sub__( self, other ) :
+
+				return LocalDispatcher.Job._Resources( self.slots - other.slots, self.threads - other.threads, self.memory - other.memory )
+
+			def fits( self, slots, threads, memory ) :
+
+				return self.slots <= slots and self.threads <= threads and self.memory <= memory
+
+		def __batchResources( self, batch ) :
+
+			# Batches needing more resources than are available are
+			# given them all, so that they still run. Zero values for
+			# threads and memory mean that the task hasn't declared its
+			# requirements, so doesn't count against the budget.
+			return LocalDispatcher.Job._Resources(
+				min( batch.blindData()["slots"].value, self.__slots ),
+				min( batch.blindData()["threads"].value, self.__threads ),
+				min( batch.blindData()["memory"].value, self.__memory ),
+			)
+
+		@staticmethod
+		def __physicalMemory() :
+
+			# In gigabytes, to match the `memory` plugs.
+			try :
+				return os.sysconf( "SC_PAGE_SIZE" ) * os.sysconf( "SC_PHYS_PAGES" ) / float( 1024 ** 3 )
+			except ( ValueError, OSError ) :
+				return float( "inf" )
 
 		def __getStatus( self, batch ) :
 
@@ -348,6 +595,24 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 			return None
 
+		def __orderedBatches( self, batch ) :
+
+			result = []
+			self.__orderedBatchesWalk( batch, set(), result )
+			return result
+
+		def __orderedBatchesWalk( self, batch, visited, result ) :
+
+			if batch in visited :
+				return
+
+			visited.add( batch )
+
+			for upstreamBatch in batch.preTasks() :
+				self.__orderedBatchesWalk( upstreamBatch, visited, result )
+
+			result.append( batch )
+
 		def __initBatchWalk( self, batch ) :
 
 			if "nodeName" in batch.blindData() :
@@ -355,9 +620,21 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				return
 
 			nodeName = ""
+			slots = 1
+			threads = 0
+			memory = 0.0
 			if batch.plug() is not None :
 				nodeName = batch.plug().node().relativeName( batch.plug().node().scriptNode() )
+				localPlug = batch.node()["dispatcher"].getChild( "local" )
+				if localPlug is not None :
+					with batch.context() :
+						slots = localPlug["slots"].getValue()
+						threads = localPlug["threads"].getValue()
+						memory = localPlug["memory"].getValue()
 			batch.blindData()["nodeName"] = nodeName
+			batch.blindData()["slots"] = IECore.IntData( slots )
+			batch.blindData()["threads"] = IECore.IntData( threads )
+			batch.blindData()["memory"] = IECore.FloatData( memory )
 
 			self.__setStatus( batch, LocalDispatcher.Job.Status.Waiting )
 
@@ -434,6 +711,17 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 		return self.__jobPool
 
+	@staticmethod
+	def _setupPlugs( parentPlug ) :
+
+		if "local" in parentPlug :
+			return
+
+		parentPlug["local"] = Gaffer.Plug()
+		parentPlug["local"]["slots"] = Gaffer.IntPlug( defaultValue = 1, minValue = 1 )
+		parentPlug["local"]["threads"] = Gaffer.IntPlug( defaultValue = 0, minValue = 0 )
+		parentPlug["local"]["memory"] = Gaffer.FloatPlug( defaultValue = 0, minValue = 0 )
+
 	def _doDispatch( self, batch ) :
 
 		job = LocalDispatcher.Job(
@@ -448,4 +736,4 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 IECore.registerRunTimeTyped( LocalDispatcher, typeName = "GafferDispatch::LocalDispatcher" )
 IECore.registerRunTimeTyped( LocalDispatcher.JobPool, typeName = "GafferDispatch::LocalDispatcher::JobPool" )
 
-GafferDispatch.Dispatcher.registerDispatcher( "Local", LocalDispatcher )
+GafferDispatch.Dispatcher.registerDispatcher( "Local", LocalDispatcher, LocalDispatcher._setupPlugs )
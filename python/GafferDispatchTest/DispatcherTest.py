@@ -1729,5 +1729,193 @@ class DispatcherTest( GafferTest.TestCase ) :
 		with self.assertRaisesRegexp( RuntimeError, "TaskPlug \"ScriptNode.badNode.task\" has no TaskNode" ) :
 			dispatcher.dispatch( [ s["taskList"] ] )
 
+	def testSkipUpToDateTasks( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		log = []
+		s["a"] = GafferDispatchTest.LoggingTaskNode( log = log )
+		s["a"]["f"] = Gaffer.StringPlug( defaultValue = "${frame}" )
+
+		s["b"] = GafferDispatchTest.LoggingTaskNode( log = log )
+		s["b"]["f"] = Gaffer.StringPlug( defaultValue = "${frame}" )
+		s["b"]["v"] = Gaffer.IntPlug()
+		s["b"]["preTasks"][0].setInput( s["a"]["task"] )
+
+		d = self.TestDispatcher()
+		d["jobsDirectory"].setValue( self.temporaryDirectory() + "/jobs" )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-3" )
+		d["skipUpToDateTasks"].setValue( True )
+
+		def executed() :
+			result = [ ( l.node.getName(), l.context.getFrame() ) for l in log ]
+			del log[:]
+			return sorted( result )
+
+		# First dispatch executes everything.
+
+		d.dispatch( [ s["b"] ] )
+		self.assertEqual( executed(), [ ( n, f ) for n in "ab" for f in ( 1, 2, 3 ) ] )
+
+		# Second dispatch executes nothing.
+
+		d.dispatch( [ s["b"] ] )
+		self.assertEqual( executed(), [] )
+
+		# Changing the downstream node reexecutes only that.
+
+		s["b"]["v"].setValue( 1 )
+		d.dispatch( [ s["b"] ] )
+		self.assertEqual( executed(), [ ( "b", f ) for f in ( 1, 2, 3 ) ] )
+
+		# Changing the upstream node reexecutes everything, because the
+		# downstream node may depend on the results.
+
+		s["a"]["f"].setValue( "${frame}.${frame}" )
+		d.dispatch( [ s["b"] ] )
+		self.assertEqual( executed(), [ ( n, f ) for n in "ab" for f in ( 1, 2, 3 ) ] )
+
+		# And without `skipUpToDateTasks`, everything is always executed.
+
+		d["skipUpToDateTasks"].setValue( False )
+		d.dispatch( [ s["b"] ] )
+		self.assertEqual( executed(), [ ( n, f ) for n in "ab" for f in ( 1, 2, 3 ) ] )
+
+	def testSkipUpToDateTasksChecksOutputFiles( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["w"] = GafferDispatchTest.TextWriter()
+		s["w"]["fileName"].setValue( self.temporaryDirectory() + "/output.####.txt" )
+		s["w"]["text"].setValue( "${frame}" )
+
+		d = self.TestDispatcher()
+		d["jobsDirectory"].setValue( self.temporaryDirectory() + "/jobs" )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-3" )
+		d["skipUpToDateTasks"].setValue( True )
+		d.dispatch( [ s["w"] ] )
+
+		fileNames = [ self.temporaryDirectory() + "/output.%04d.txt" % f for f in ( 1, 2, 3 ) ]
+		for i, fileName in enumerate( fileNames ) :
+			with open( fileName ) as f :
+				self.assertEqual( f.read(), str( i + 1 ) )
+
+		# Modify frame 1 without changing the modification time, so it
+		# appears to be untouched. Remove frame 2, and make frame 3 appear
+		# to have been modified since the dispatch.
+
+		mTime = os.path.getmtime( fileNames[0] )
+		with open( fileNames[0], "w" ) as f :
+			f.write( "untouched" )
+		os.utime( fileNames[0], ( mTime, mTime ) )
+
+		os.remove( fileNames[1] )
+
+		with open( fileNames[2], "w" ) as f :
+			f.write( "modified" )
+		os.utime( fileNames[2], ( mTime - 10, mTime - 10 ) )
+
+		# Only frames 2 and 3 should be reexecuted.
+
+		d.dispatch( [ s["w"] ] )
+
+		with open( fileNames[0] ) as f :
+			self.assertEqual( f.read(), "untouched" )
+		with open( fileNames[1] ) as f :
+			self.assertEqual( f.read(), "2" )
+		with open( fileNames[2] ) as f :
+			self.assertEqual( f.read(), "3" )
+
+	def testParallelFrames( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["c"] = GafferDispatch.PythonCommand()
+		s["c"]["command"].setValue(
+			"import time\n"
+			"start = time.time()\n"
+			"time.sleep( 0.5 )\n"
+			"with open( '{0}/%d.txt' % context.getFrame(), 'w' ) as f :\n"
+			"	f.write( '%f %f' % ( start, time.time() ) )\n".format( self.temporaryDirectory() )
+		)
+		s["c"]["dispatcher"]["batchSize"].setValue( 4 )
+
+		d = self.TestDispatcher()
+		d["jobsDirectory"].setValue( self.temporaryDirectory() + "/jobs" )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-4" )
+
+		def intervals() :
+			result = []
+			for frame in range( 1, 5 ) :
+				with open( "{0}/{1}.txt".format( self.temporaryDirectory(), frame ) ) as f :
+					result.append( [ float( x ) for x in f.read().split() ] )
+			return result
+
+		def overlaps( a, b ) :
+			return a[0] < b[1] and b[0] < a[1]
+
+		# By default, frames are executed one after another.
+
+		d.dispatch( [ s["c"] ] )
+		i = intervals()
+		for a, b in itertools.combinations( i, 2 ) :
+			self.assertFalse( overlaps( a, b ) )
+
+		# But they may be executed in parallel if the node
+		# opts in.
+
+		s["c"]["dispatcher"]["parallelFrames"].setValue( True )
+		d.dispatch( [ s["c"] ] )
+		i = intervals()
+		self.assertTrue( any( overlaps( a, b ) for a, b in itertools.combinations( i, 2 ) ) )
+
+	def testParallelFramesIgnoredForSequences( self ) :
+
+		s = Gaffer.ScriptNode()
+		log = []
+		s["n"] = GafferDispatchTest.LoggingTaskNode( log = log )
+		s["n"]["requiresSequenceExecution"].setValue( True )
+		s["n"]["dispatcher"]["parallelFrames"].setValue( True )
+
+		d = self.TestDispatcher()
+		d["jobsDirectory"].setValue( self.temporaryDirectory() )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-4" )
+		d.dispatch( [ s["n"] ] )
+
+		self.assertEqual( len( log ), 1 )
+		self.assertEqual( log[0].frames, [ 1, 2, 3, 4 ] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testBatchingPerformance( self ) :
+
+		# Measures the time taken to construct the TaskBatch graph
+		# for many frames of a moderately large number of tasks.
+
+		s = Gaffer.ScriptNode()
+		s["list"] = GafferDispatch.TaskList()
+
+		for i in range( 0, 20 ) :
+			previous = None
+			for j in range( 0, 10 ) :
+				n = GafferDispatch.SystemCommand( "n{0}_{1}".format( i, j ) )
+				n["command"].setValue( "echo {0} {1} ${{frame}}".format( i, j ) )
+				if previous is not None :
+					n["preTasks"][0].setInput( previous["task"] )
+				s.addChild( n )
+				previous = n
+			s["list"]["preTasks"][i].setInput( previous["task"] )
+
+		d = self.NullDispatcher()
+		d["jobsDirectory"].setValue( self.temporaryDirectory() )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-500" )
+
+		d.dispatch( [ s["list"] ] )
+
+		# One no-op batch per frame for the TaskList.
+		self.assertEqual( len( d.lastDispatch.preTasks() ), 500 )
+
 if __name__ == "__main__":
 	unittest.main()
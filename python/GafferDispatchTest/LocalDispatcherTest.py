@@ -53,9 +53,9 @@ import GafferDispatchTest
 
 class LocalDispatcherTest( GafferTest.TestCase ) :
 
-	def __createLocalDispatcher( self ) :
+	def __createLocalDispatcher( self, jobPool = None ) :
 
-		result = GafferDispatch.LocalDispatcher()
+		result = GafferDispatch.LocalDispatcher( jobPool = jobPool )
 		result["jobsDirectory"].setValue( self.temporaryDirectory() )
 		return result
 
@@ -673,6 +673,40 @@ class LocalDispatcherTest( GafferTest.TestCase ) :
 
 		self.assertTrue( os.path.isfile( self.temporaryDirectory() + "/scriptLoadErrorTest.txt" ) )
 
+	def testPartialLoad( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		# A node which isn't a dependency of the task, and which
+		# is therefore only loaded if partial loading is off.
+		s["other"] = GafferTest.AddNode()
+
+		testFile = os.path.join( self.temporaryDirectory(), "test.txt" )
+		s["c"] = GafferDispatch.PythonCommand()
+		s["c"]["command"].setValue( inspect.cleandoc(
+			"""
+			with open( "{0}", "w" ) as f :
+				f.write( str( "other" in self.scriptNode() ) )
+			""".format( testFile )
+		) )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["executeInBackground"].setValue( True )
+		self.assertFalse( dispatcher["partialLoad"].getValue() )
+
+		dispatcher.dispatch( [ s["c"] ] )
+		dispatcher.jobPool().waitForAll()
+
+		with open( testFile ) as f :
+			self.assertEqual( f.read(), "True" )
+
+		dispatcher["partialLoad"].setValue( True )
+		dispatcher.dispatch( [ s["c"] ] )
+		dispatcher.jobPool().waitForAll()
+
+		with open( testFile ) as f :
+			self.assertEqual( f.read(), "False" )
+
 	def testBackgroundBatchesCanAccessJobDirectory( self ) :
 
 		s = Gaffer.ScriptNode()
@@ -853,5 +887,222 @@ class LocalDispatcherTest( GafferTest.TestCase ) :
 			open( self.temporaryDirectory() + "/outer.txt" ).readlines(),
 		)
 
+	def __intervalsScript( self ) :
+
+		# Creates a script with four independent tasks followed by
+		# a downstream task, each recording the time interval over
+		# which it executed.
+
+		s = Gaffer.ScriptNode()
+
+		command = inspect.cleandoc(
+			"""
+			import time
+			start = time.time()
+			time.sleep( {sleep} )
+			with open( "{directory}/{name}.txt", "w" ) as f :
+				f.write( "%f %f" % ( start, time.time() ) )
+			"""
+		)
+
+		s["list"] = GafferDispatch.TaskList()
+		for i in range( 0, 4 ) :
+			n = GafferDispatch.PythonCommand()
+			n["command"].setValue( command.format( sleep = 2, directory = self.temporaryDirectory(), name = "n%d" % i ) )
+			s["n%d" % i] = n
+			s["list"]["preTasks"][i].setInput( n["task"] )
+
+		s["last"] = GafferDispatch.PythonCommand()
+		s["last"]["command"].setValue( command.format( sleep = 0, directory = self.temporaryDirectory(), name = "last" ) )
+		s["last"]["preTasks"][0].setInput( s["list"]["task"] )
+
+		return s
+
+	def __intervals( self ) :
+
+		result = {}
+		for name in [ "n0", "n1", "n2", "n3", "last" ] :
+			with open( "{0}/{1}.txt".format( self.temporaryDirectory(), name ) ) as f :
+				result[name] = [ float( x ) for x in f.read().split() ]
+
+		return result
+
+	def __overlaps( self, a, b ) :
+
+		return a[0] < b[1] and b[0] < a[1]
+
+	def testConcurrentExecution( self ) :
+
+		s = self.__intervalsScript()
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["slots"].setValue( 4 )
+		d.dispatch( [ s["last"] ] )
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().failedJobs() ), 0 )
+
+		intervals = self.__intervals()
+
+		# The independent tasks should all have run at the same time.
+		for a in [ "n0", "n1", "n2", "n3" ] :
+			for b in [ "n0", "n1", "n2", "n3" ] :
+				self.assertTrue( self.__overlaps( intervals[a], intervals[b] ) )
+
+		# But the downstream task must still wait for them.
+		for n in [ "n0", "n1", "n2", "n3" ] :
+			self.assertGreaterEqual( intervals["last"][0], intervals[n][1] )
+
+	def testSingleSlotExecutesSerially( self ) :
+
+		s = self.__intervalsScript()
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		self.assertEqual( d["slots"].getValue(), 1 )
+		d.dispatch( [ s["last"] ] )
+		d.jobPool().waitForAll()
+
+		intervals = self.__intervals()
+		for a in intervals.keys() :
+			for b in intervals.keys() :
+				if a != b :
+					self.assertFalse( self.__overlaps( intervals[a], intervals[b] ) )
+
+	def testTaskSlots( self ) :
+
+		s = self.__intervalsScript()
+		self.assertEqual( s["n0"]["dispatcher"]["local"]["slots"].getValue(), 1 )
+		s["n0"]["dispatcher"]["local"]["slots"].setValue( 3 )
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["slots"].setValue( 3 )
+		d.dispatch( [ s["last"] ] )
+		d.jobPool().waitForAll()
+
+		# n0 needs all the slots, so should have run on its own.
+
+		intervals = self.__intervals()
+		for n in [ "n1", "n2", "n3" ] :
+			self.assertFalse( self.__overlaps( intervals["n0"], intervals[n] ) )
+
+		self.assertTrue( self.__overlaps( intervals["n1"], intervals["n2"] ) )
+
+	def testResourceBudgets( self ) :
+
+		for budget, requirement in [
+			( "threads", 2 ),
+			( "memory", 5.0 ),
+		] :
+
+			s = self.__intervalsScript()
+			for n in [ "n0", "n1", "n2", "n3" ] :
+				s[n]["dispatcher"]["local"][budget].setValue( requirement )
+
+			d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+			d["executeInBackground"].setValue( True )
+			d["slots"].setValue( 4 )
+			d[budget].setValue( requirement * 2 )
+			d.dispatch( [ s["last"] ] )
+			d.jobPool().waitForAll()
+			self.assertEqual( len( d.jobPool().failedJobs() ), 0 )
+
+			# The budget only allows two tasks to run at once.
+
+			intervals = self.__intervals()
+			for n in [ "n0", "n1", "n2", "n3" ] :
+				overlapping = [ o for o in [ "n0", "n1", "n2", "n3" ] if o != n and self.__overlaps( intervals[n], intervals[o] ) ]
+				self.assertEqual( len( overlapping ), 1 )
+
+			for n in [ "n0", "n1", "n2", "n3", "last" ] :
+				os.remove( os.path.join( self.temporaryDirectory(), n + ".txt" ) )
+
+	def testKillConcurrentExecution( self ) :
+
+		s = self.__intervalsScript()
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["slots"].setValue( 4 )
+		d.dispatch( [ s["last"] ] )
+
+		d.jobPool().jobs()[0].kill()
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().jobs() ), 0 )
+
+		for name in [ "n0", "n1", "n2", "n3", "last" ] :
+			self.assertFalse( os.path.exists( "{0}/{1}.txt".format( self.temporaryDirectory(), name ) ) )
+
+	def testPersistentWorkers( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["n1"] = GafferDispatch.PythonCommand()
+		s["n1"]["command"].setValue( inspect.cleandoc(
+			"""
+			import os
+			with open( "{0}/n1.{1}.txt".format( "%s", context.getFrame() ), "w" ) as f :
+				f.write( str( os.getpid() ) )
+			""" % self.temporaryDirectory()
+		) )
+
+		s["n2"] = GafferDispatch.PythonCommand()
+		s["n2"]["command"].setValue( inspect.cleandoc(
+			"""
+			import os
+			with open( "{0}/n2.{1}.txt".format( "%s", context["n2:value"] ), "w" ) as f :
+				f.write( str( os.getpid() ) )
+			""" % self.temporaryDirectory()
+		) )
+		s["n2"]["preTasks"][0].setInput( s["n1"]["task"] )
+
+		s["variables"] = GafferDispatch.TaskContextVariables()
+		s["variables"]["preTasks"][0].setInput( s["n2"]["task"] )
+		s["variables"]["variables"].addChild( Gaffer.NameValuePlug( "n2:value", "fromContext" ) )
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["persistentWorkers"].setValue( True )
+		d["framesMode"].setValue( d.FramesMode.CustomRange )
+		d["frameRange"].setValue( "1-3" )
+		d.dispatch( [ s["variables"] ] )
+		d.jobPool().waitForAll()
+		self.assertEqual( len( d.jobPool().failedJobs() ), 0 )
+
+		# All the batches should have been executed, with the
+		# context variables passed through to the worker.
+
+		pids = set()
+		for fileName in [ "n1.1.txt", "n1.2.txt", "n1.3.txt", "n2.fromContext.txt" ] :
+			with open( os.path.join( self.temporaryDirectory(), fileName ) ) as f :
+				pids.add( int( f.read() ) )
+
+		# And because we're only using a single slot, they should
+		# all have been executed by the same worker.
+
+		self.assertEqual( len( pids ), 1 )
+		self.assertNotEqual( pids.pop(), os.getpid() )
+
+	def testPersistentWorkerFailure( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["n1"] = GafferDispatch.PythonCommand()
+		s["n1"]["command"].setValue( "raise RuntimeError( 'Oops' )" )
+
+		s["n2"] = GafferDispatchTest.TextWriter()
+		s["n2"]["fileName"].setValue( self.temporaryDirectory() + "/n2.txt" )
+		s["n2"]["preTasks"][0].setInput( s["n1"]["task"] )
+
+		d = self.__createLocalDispatcher( jobPool = GafferDispatch.LocalDispatcher.JobPool() )
+		d["executeInBackground"].setValue( True )
+		d["persistentWorkers"].setValue( True )
+		d.dispatch( [ s["n2"] ] )
+		d.jobPool().waitForAll()
+
+		self.assertEqual( len( d.jobPool().failedJobs() ), 1 )
+		self.assertFalse( os.path.exists( self.temporaryDirectory() + "/n2.txt" ) )
+
 if __name__ == "__main__":
 	unittest.main()
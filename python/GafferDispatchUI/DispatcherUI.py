@@ -118,6 +118,21 @@ Gaffer.Metadata.registerNode(
 
 		),
 
+		"skipUpToDateTasks" : (
+
+			"description",
+			"""
+			Skips tasks which have already been completed by a previous
+			dispatch of the same job, and which are still up to date.
+			A task is considered up to date if its settings are unchanged,
+			the file it writes (if any) hasn't been modified since, and all
+			the tasks it depends on are also up to date. Completed tasks
+			are recorded in a `taskDatabase` directory alongside the
+			job directories.
+			""",
+
+		),
+
 	}
 
 )
@@ -143,6 +158,24 @@ Gaffer.Metadata.registerNode(
 
 		),
 
+		"dispatcher.parallelFrames" : (
+
+			"description",
+			"""
+			Executes the frames of each batch concurrently in separate threads,
+			rather than one after another. This only applies when batches are
+			executed within the dispatching process, as they are by the
+			LocalDispatcher when not executing in the background, and it
+			requires a `batchSize` greater than 1 to have any effect. The
+			frames share a single script and cache, avoiding the overhead of
+			launching separate processes for lightweight tasks.
+
+			> Caution : Only turn this on for nodes which are safe to
+			> execute on several frames at once.
+			""",
+
+		),
+
 		"dispatcher.immediate" : (
 
 			"description",
@@ -75,6 +75,20 @@ Gaffer.Metadata.registerNode(
 
 		),
 
+		"partialLoad" : (
+
+			"description",
+			"""
+			Loads only the nodes being executed and the nodes they depend on
+			when executing in the background, rather than the whole script.
+			This can significantly reduce the time taken to start each task,
+			but must not be used if tasks access other nodes by name when they
+			execute, as those nodes may not be loaded. Persistent workers always
+			load the whole script.
+			""",
+
+		),
+
 		"environmentCommand" : (
 
 			"description",
@@ -97,6 +111,118 @@ Gaffer.Metadata.registerNode(
 
 		),
 
+		"slots" : (
+
+			"description",
+			"""
+			The number of slots available for running tasks concurrently
+			when executing in the background. Independent tasks are run
+			in parallel as long as there are enough free slots, with each
+			task occupying the number of slots specified by its
+			`dispatcher.local.slots` plug. Dependencies between tasks are
+			always respected.
+			""",
+
+		),
+
+		"threads" : (
+
+			"description",
+			"""
+			The number of threads available for running tasks concurrently.
+			Tasks which declare the number of threads they need using their
+			`dispatcher.local.threads` plug are only launched when enough
+			threads are free. A value of 0 uses all the hardware threads
+			on the machine.
+			""",
+
+		),
+
+		"memory" : (
+
+			"description",
+			"""
+			The amount of memory, in gigabytes, available for running tasks
+			concurrently. Tasks which declare their peak memory usage using
+			their `dispatcher.local.memory` plug are only launched when
+			enough memory is free. A value of 0 uses all the physical memory
+			on the machine.
+			""",
+
+		),
+
+		"persistentWorkers" : (
+
+			"description",
+			"""
+			When executing in the background, executes tasks using long-lived
+			worker processes rather than launching a new `gaffer execute ...`
+			process for every batch. Each worker loads the script only once,
+			and keeps its caches between batches, which can significantly
+			reduce the overhead of dispatching large scripts. Workers are
+			shut down when the job finishes.
+			""",
+
+		),
+
+	}
+
+)
+
+Gaffer.Metadata.registerNode(
+
+	GafferDispatch.TaskNode,
+
+	plugs = {
+
+		"dispatcher.local" : [
+
+			"description",
+			"""
+			Settings that control how tasks are
+			executed by the LocalDispatcher.
+			""",
+
+			"layout:section", "Local",
+			"plugValueWidget:type", "GafferUI.LayoutPlugValueWidget",
+
+		],
+
+		"dispatcher.local.slots" : [
+
+			"description",
+			"""
+			The number of the LocalDispatcher's slots occupied by
+			this task while it runs. Heavy tasks may be given more
+			slots to limit the number of other tasks that run
+			alongside them.
+			""",
+
+		],
+
+		"dispatcher.local.threads" : [
+
+			"description",
+			"""
+			The number of threads needed by this task. The task is only
+			launched when this many of the LocalDispatcher's threads are
+			free, and is limited to using this many threads. A value of 0
+			leaves the thread usage unspecified and unlimited.
+			""",
+
+		],
+
+		"dispatcher.local.memory" : [
+
+			"description",
+			"""
+			The peak memory usage of this task, in gigabytes. The task is
+			only launched when this much of the LocalDispatcher's memory is
+			free. A value of 0 leaves the memory usage unspecified.
+			""",
+
+		],
+
 	}
 
 )
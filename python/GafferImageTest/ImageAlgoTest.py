@@ -35,6 +35,7 @@
 ##########################################################################
 
 import unittest
+import random
 import imath
 
 import IECore
@@ -273,5 +274,40 @@ class ImageAlgoTest( GafferImageTest.ImageTestCase ) :
 			numTilesX * numTilesY * 4
 		)
 
+	def testParallelProcessTilesInOrder( self ) :
+
+		c = GafferImage.Checkerboard()
+		c["format"].setValue( GafferImage.Format( 10 * GafferImage.ImagePlug.tileSize(), 8 * GafferImage.ImagePlug.tileSize() ) )
+
+		# Deliberately in neither raster nor scanline order.
+
+		r = random.Random( 0 )
+		tileOrigins = [
+			imath.V2i( x, y ) * GafferImage.ImagePlug.tileSize()
+			for y in range( 0, 8 ) for x in range( 0, 10 )
+		]
+		r.shuffle( tileOrigins )
+
+		# In parallel, every tile should be processed exactly once,
+		# with the tile origin in the context matching the one
+		# passed to the functor.
+
+		calls = GafferImageTest.processTilesInOrder( c["out"], tileOrigins )
+		key = lambda v : ( v.x, v.y )
+		self.assertEqual( sorted( [ x[0] for x in calls ], key = key ), sorted( tileOrigins, key = key ) )
+		for tileOrigin, contextTileOrigin in calls :
+			self.assertEqual( contextTileOrigin, tileOrigin )
+
+		# With a single thread, the functor should be called in the
+		# order the tiles were given.
+
+		calls = GafferImageTest.processTilesInOrder( c["out"], tileOrigins, serial = True )
+		self.assertEqual( [ x[0] for x in calls ], tileOrigins )
+		self.assertEqual( [ x[1] for x in calls ], tileOrigins )
+
+		# An empty list should be fine.
+
+		self.assertEqual( GafferImageTest.processTilesInOrder( c["out"], [] ), [] )
+
 if __name__ == "__main__":
 	unittest.main()
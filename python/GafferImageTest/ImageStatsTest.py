@@ -40,6 +40,7 @@ import imath
 
 import IECore
 
+import Gaffer
 import GafferTest
 import GafferImage
 import GafferImageTest
@@ -187,6 +188,133 @@ class ImageStatsTest( GafferImageTest.ImageTestCase ) :
 		self.assertEqual( s["min"].getValue(), imath.Color4f( 1 ) )
 		self.assertEqual( s["max"].getValue(), imath.Color4f( 1 ) )
 
+	def testAreaOutsideDataWindow( self ) :
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 100, 100 ) )
+		c["color"].setValue( imath.Color4f( 0.5 ) )
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( c["out"] )
+		s["area"].setValue( imath.Box2i( imath.V2i( 50 ), imath.V2i( 150 ) ) )
+
+		# Pixels outside the data window are treated as black.
+		self.__assertColour( s["average"].getValue(), imath.Color4f( 0.125 ) )
+		self.__assertColour( s["min"].getValue(), imath.Color4f( 0 ) )
+		self.__assertColour( s["max"].getValue(), imath.Color4f( 0.5 ) )
+
+	def testNegativeMax( self ) :
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 100, 100 ) )
+		c["color"].setValue( imath.Color4f( -1 ) )
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( c["out"] )
+		s["area"].setValue( c["out"]["format"].getValue().getDisplayWindow() )
+
+		self.__assertColour( s["max"].getValue(), imath.Color4f( -1 ) )
+
+	def testHistogram( self ) :
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 100, 100 ) )
+		c["color"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( c["out"] )
+		s["area"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 150, 100 ) ) )
+		s["histogramBins"].setValue( 4 )
+
+		self.assertEqual( s["histogram"]["r"].getValue(), IECore.IntVectorData( [ 5000, 10000, 0, 0 ] ) )
+		self.assertEqual( s["histogram"]["g"].getValue(), IECore.IntVectorData( [ 5000, 0, 10000, 0 ] ) )
+		self.assertEqual( s["histogram"]["b"].getValue(), IECore.IntVectorData( [ 5000, 0, 0, 10000 ] ) )
+		self.assertEqual( s["histogram"]["a"].getValue(), IECore.IntVectorData( [ 5000, 0, 0, 10000 ] ) )
+
+		s["histogramRange"].setValue( imath.V2f( 0.5, 1 ) )
+		self.assertEqual( s["histogram"]["r"].getValue(), IECore.IntVectorData( [ 15000, 0, 0, 0 ] ) )
+
+		s["channels"].setValue( IECore.StringVectorData( [ "", "G", "B", "A" ] ) )
+		self.assertEqual( s["histogram"]["r"].getValue(), IECore.IntVectorData() )
+
+	def testHistogramOutOfRangeValues( self ) :
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 100, 100 ) )
+		c["color"].setValue( imath.Color4f( float( "inf" ), 1e30, -5, 0.5 ) )
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( c["out"] )
+		s["area"].setValue( c["out"]["format"].getValue().getDisplayWindow() )
+		s["histogramBins"].setValue( 4 )
+
+		# Values above the range go in the last bin, and values
+		# below it go in the first.
+
+		self.assertEqual( s["histogram"]["r"].getValue(), IECore.IntVectorData( [ 0, 0, 0, 10000 ] ) )
+		self.assertEqual( s["histogram"]["g"].getValue(), IECore.IntVectorData( [ 0, 0, 0, 10000 ] ) )
+		self.assertEqual( s["histogram"]["b"].getValue(), IECore.IntVectorData( [ 10000, 0, 0, 0 ] ) )
+		self.assertEqual( s["histogram"]["a"].getValue(), IECore.IntVectorData( [ 0, 0, 10000, 0 ] ) )
+
+		# Degenerate ranges must be dealt with in the same way.
+
+		s["histogramRange"].setValue( imath.V2f( 0.25 ) )
+		self.assertEqual( s["histogram"]["r"].getValue(), IECore.IntVectorData( [ 0, 0, 0, 10000 ] ) )
+		self.assertEqual( s["histogram"]["g"].getValue(), IECore.IntVectorData( [ 0, 0, 0, 10000 ] ) )
+		self.assertEqual( s["histogram"]["b"].getValue(), IECore.IntVectorData( [ 10000, 0, 0, 0 ] ) )
+		self.assertEqual( s["histogram"]["a"].getValue(), IECore.IntVectorData( [ 0, 0, 0, 10000 ] ) )
+
+		s["histogramRange"].setValue( imath.V2f( 0, 1e-30 ) )
+		self.assertEqual( s["histogram"]["a"].getValue(), IECore.IntVectorData( [ 0, 0, 0, 10000 ] ) )
+
+	def testPercentile( self ) :
+
+		r = GafferImage.ImageReader()
+		r["fileName"].setValue( self.__rgbFilePath )
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( r["out"] )
+		s["area"].setValue( r["out"]["format"].getValue().getDisplayWindow() )
+		s["histogramBins"].setValue( 1000 )
+
+		s["percentile"].setValue( 0 )
+		for i in range( 0, 4 ) :
+			self.assertAlmostEqual( s["percentileValue"].getValue()[i], s["min"].getValue()[i], delta = 0.002 )
+
+		s["percentile"].setValue( 100 )
+		for i in range( 0, 4 ) :
+			self.assertAlmostEqual( s["percentileValue"].getValue()[i], s["max"].getValue()[i], delta = 0.002 )
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 100, 100 ) )
+		c["color"].setValue( imath.Color4f( 0.25 ) )
+		s["in"].setInput( c["out"] )
+		s["percentile"].setValue( 50 )
+		self.assertAlmostEqual( s["percentileValue"].getValue()[0], 0.25, delta = 0.002 )
+
+	def testAreaChangeOnlyRecomputesBorderTiles( self ) :
+
+		numTiles = 16
+
+		c = GafferImage.Checkerboard()
+		c["format"].setValue(
+			GafferImage.Format( numTiles * GafferImage.ImagePlug.tileSize(), numTiles * GafferImage.ImagePlug.tileSize() )
+		)
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( c["out"] )
+		area = c["out"]["format"].getValue().getDisplayWindow()
+		s["area"].setValue( area )
+		s["average"].getValue()
+
+		area.setMax( area.max() - imath.V2i( 1, 0 ) )
+		s["area"].setValue( area )
+
+		with Gaffer.PerformanceMonitor() as m :
+			s["average"].getValue()
+
+		self.assertLessEqual( m.plugStatistics( s["__tileStats"] ).computeCount, numTiles * 4 )
+
 	def __assertColour( self, colour1, colour2 ) :
 		for i in range( 0, 4 ):
 			self.assertEqual( "%.4f" % colour2[i], "%.4f" % colour1[i] )
@@ -1232,5 +1232,73 @@ class ImageWriterTest( GafferImageTest.ImageTestCase ) :
 		cleanOutput["channels"].setValue( "A" )
 		self.assertImagesEqual( reader["out"], cleanOutput["out"], ignoreMetadata=True, ignoreDataWindow=True, maxDifference=0.05 )
 
+	def testMultipleScanlineBatches( self ) :
+
+		# Create an image large enough that the scanlines are
+		# written in several separate batches.
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 4096, 1100 ) )
+
+		# Offset so that the first and last rows of tiles are
+		# only partially inside the data window.
+		offset = GafferImage.Offset()
+		offset["in"].setInput( checkerboard["out"] )
+		offset["offset"].setValue( imath.V2i( 0, 30 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( offset["out"] )
+		writer["fileName"].setValue( "{0}/multipleBatches.exr".format( self.temporaryDirectory() ) )
+		writer["openexr"]["dataType"].setValue( "float" )
+		writer["task"].execute()
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setInput( writer["fileName"] )
+		self.assertImagesEqual( reader["out"], offset["out"], ignoreMetadata = True )
+
+	def testCropToFormat( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 512, 512 ) )
+
+		# Shrink the display window, leaving a large overscan
+		# region in the data window.
+		crop = GafferImage.Crop()
+		crop["in"].setInput( checkerboard["out"] )
+		crop["area"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 128 ) ) )
+		crop["affectDataWindow"].setValue( False )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( crop["out"] )
+		writer["fileName"].setValue( "{0}/cropToFormat.exr".format( self.temporaryDirectory() ) )
+		writer["cropToFormat"].setValue( True )
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as monitor :
+			writer["task"].execute()
+
+		# Only the tiles inside the display window should
+		# have been computed.
+		numTiles = ( 128 // GafferImage.ImagePlug.tileSize() ) ** 2
+		self.assertEqual(
+			monitor.plugStatistics( checkerboard["out"]["channelData"] ).computeCount,
+			numTiles * 4
+		)
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setInput( writer["fileName"] )
+		self.assertEqual( reader["out"]["format"].getValue(), crop["out"]["format"].getValue() )
+		self.assertEqual( reader["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( 0 ), imath.V2i( 128 ) ) )
+
+		fullCrop = GafferImage.Crop()
+		fullCrop["in"].setInput( checkerboard["out"] )
+		fullCrop["area"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 128 ) ) )
+		self.assertImagesEqual( reader["out"], fullCrop["out"], ignoreMetadata = True, maxDifference = 0.0005 )
+
+		# Changing the setting should change the hash.
+
+		h = writer.hash( Gaffer.Context() )
+		writer["cropToFormat"].setValue( False )
+		self.assertNotEqual( writer.hash( Gaffer.Context() ), h )
+
 if __name__ == "__main__":
 	unittest.main()
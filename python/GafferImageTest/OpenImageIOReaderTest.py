@@ -40,6 +40,7 @@ import shutil
 import unittest
 import imath
 import random
+import time
 
 import IECore
 import IECoreImage
@@ -595,6 +596,167 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		self.assertEqual( len( mh.messages ), 1 )
 		self.assertTrue( mh.messages[0].message.startswith( "Ignoring subimage 1 of " ) )
 
+	def testReadAhead( self ) :
+
+		# Write images large enough to span several tile batches,
+		# in both scanline and tiled modes.
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 1500, 1300 ) )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( checkerboard["out"] )
+		offset["offset"].setValue( imath.V2i( -13, 27 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( offset["out"] )
+		writer["openexr"]["dataType"].setValue( "float" )
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		threads = GafferImage.OpenImageIOReader.getReadAheadThreads()
+		self.addCleanup( GafferImage.OpenImageIOReader.setReadAheadThreads, threads )
+
+		for mode in [ GafferImage.ImageWriter.Mode.Scanline, GafferImage.ImageWriter.Mode.Tile ] :
+
+			writer["fileName"].setValue( "{0}/readAhead{1}.exr".format( self.temporaryDirectory(), mode ) )
+			writer["openexr"]["mode"].setValue( mode )
+			writer["task"].execute()
+
+			# Read-ahead doesn't affect the result, so shouldn't affect the hash.
+			reader["readAhead"].setValue( 0 )
+			hash = reader["out"].imageHash()
+			reader["readAhead"].setValue( 4 )
+			self.assertEqual( reader["out"].imageHash(), hash )
+
+			for numThreads in [ 0, 1, 4 ] :
+				for readAhead in [ 0, 1, 3, 8 ] :
+					GafferImage.OpenImageIOReader.setReadAheadThreads( numThreads )
+					self.assertEqual( GafferImage.OpenImageIOReader.getReadAheadThreads(), numThreads )
+					reader["readAhead"].setValue( readAhead )
+					reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
+					self.assertImagesEqual( reader["out"], offset["out"], ignoreMetadata = True )
+
+	def testReadAheadStatistics( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 300, 1300 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( checkerboard["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() + "/readAheadStatistics.exr" )
+		writer["openexr"]["mode"].setValue( GafferImage.ImageWriter.Mode.Scanline )
+		writer["task"].execute()
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setInput( writer["fileName"] )
+		reader["readAhead"].setValue( 4 )
+
+		threads = GafferImage.OpenImageIOReader.getReadAheadThreads()
+		self.addCleanup( GafferImage.OpenImageIOReader.setReadAheadThreads, threads )
+		GafferImage.OpenImageIOReader.setReadAheadThreads( 2 )
+
+		# Request tiles serially, in file order, so that we know
+		# exactly which batches will be read ahead.
+
+		def readTiles() :
+
+			dataWindow = reader["out"]["dataWindow"].getValue()
+			tileSize = GafferImage.ImagePlug.tileSize()
+			with Gaffer.Context() as c :
+				c["image:channelName"] = "R"
+				y = GafferImage.ImagePlug.tileOrigin( dataWindow.max() - imath.V2i( 1 ) ).y
+				while y >= GafferImage.ImagePlug.tileOrigin( dataWindow.min() ).y :
+					for x in range( 0, dataWindow.max().x, tileSize ) :
+						c["image:tileOrigin"] = imath.V2i( x, y )
+						reader["out"]["channelData"].getValue()
+					y -= tileSize
+
+		GafferImage.OpenImageIOReader.resetReadAheadStatistics()
+		readTiles()
+
+		# Every batch other than the first should have been read ahead
+		# and then used, and the reads should have been coalesced.
+
+		numBatches = ( 1300 + GafferImage.ImagePlug.tileSize() - 1 ) // GafferImage.ImagePlug.tileSize()
+		statistics = GafferImage.OpenImageIOReader.readAheadStatistics()
+		self.assertEqual( statistics.batchesRead, numBatches - 1 )
+		self.assertEqual( statistics.batchesUsed, numBatches - 1 )
+		self.assertLess( statistics.reads, statistics.batchesRead )
+
+		# No read-ahead should occur when it is turned off.
+
+		reader["readAhead"].setValue( 0 )
+		reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
+		GafferImage.OpenImageIOReader.resetReadAheadStatistics()
+		readTiles()
+
+		statistics = GafferImage.OpenImageIOReader.readAheadStatistics()
+		self.assertEqual( statistics.reads, 0 )
+		self.assertEqual( statistics.batchesRead, 0 )
+		self.assertEqual( statistics.batchesUsed, 0 )
+
+	def testReadAheadMemoryLimit( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 300, 1300 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( checkerboard["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() + "/readAheadMemoryLimit.exr" )
+		writer["openexr"]["mode"].setValue( GafferImage.ImageWriter.Mode.Scanline )
+		writer["task"].execute()
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setInput( writer["fileName"] )
+		reader["readAhead"].setValue( 4 )
+
+		limit = GafferImage.OpenImageIOReader.getReadAheadMemoryLimit()
+		self.addCleanup( GafferImage.OpenImageIOReader.setReadAheadMemoryLimit, limit )
+
+		def readTiles() :
+
+			dataWindow = reader["out"]["dataWindow"].getValue()
+			tileSize = GafferImage.ImagePlug.tileSize()
+			with Gaffer.Context() as c :
+				c["image:channelName"] = "R"
+				y = GafferImage.ImagePlug.tileOrigin( dataWindow.max() - imath.V2i( 1 ) ).y
+				while y >= GafferImage.ImagePlug.tileOrigin( dataWindow.min() ).y :
+					c["image:tileOrigin"] = imath.V2i( 0, y )
+					reader["out"]["channelData"].getValue()
+					self.assertLessEqual(
+						GafferImage.OpenImageIOReader.readAheadMemoryUsage(),
+						GafferImage.OpenImageIOReader.getReadAheadMemoryLimit()
+					)
+					y -= tileSize
+
+		GafferImage.OpenImageIOReader.resetReadAheadStatistics()
+		readTiles()
+		self.assertGreater( GafferImage.OpenImageIOReader.readAheadStatistics().batchesRead, 0 )
+
+		# Closing the file should release the memory held by any
+		# batches that were read ahead but never used. Reads still
+		# in flight keep the file open until they complete.
+
+		reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
+		t = time.time()
+		while GafferImage.OpenImageIOReader.readAheadMemoryUsage() and time.time() - t < 10 :
+			time.sleep( 0.01 )
+		self.assertEqual( GafferImage.OpenImageIOReader.readAheadMemoryUsage(), 0 )
+
+		# No read-ahead should occur when the memory limit is too
+		# small to hold any batches.
+
+		GafferImage.OpenImageIOReader.setReadAheadMemoryLimit( 0 )
+		reader["refreshCount"].setValue( reader["refreshCount"].getValue() + 1 )
+		GafferImage.OpenImageIOReader.resetReadAheadStatistics()
+		readTiles()
+
+		statistics = GafferImage.OpenImageIOReader.readAheadStatistics()
+		self.assertEqual( statistics.reads, 0 )
+		self.assertEqual( statistics.batchesRead, 0 )
+		self.assertEqual( GafferImage.OpenImageIOReader.readAheadMemoryUsage(), 0 )
 
 if __name__ == "__main__":
 	unittest.main()
@@ -0,0 +1,176 @@
+##########################################################################
+#
+#  Copyright (c) 2019, Image Engine Design Inc. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import math
+import random
+import unittest
+import imath
+
+import IECore
+import IECoreImage
+
+import Gaffer
+import GafferImage
+import GafferImageTest
+
+# Tests the behaviour shared by Median, Erode and Dilate, by comparing
+# their output against a brute force reference implementation. Radii are
+# chosen to exercise both the brute force and sliding window code paths,
+# which switch over when the window has more than 25 pixels.
+class RankFilterTest( GafferImageTest.ImageTestCase ) :
+
+	__radii = [
+		# Brute force
+		imath.V2i( 2, 1 ), imath.V2i( 1, 3 ),
+		# Sliding window
+		imath.V2i( 5, 1 ), imath.V2i( 1, 5 ), imath.V2i( 4, 6 ),
+	]
+
+	def testAgainstBruteForce( self ) :
+
+		image = self.__randomImage( nanPixels = [] )
+		for nodeType in ( GafferImage.Median, GafferImage.Erode, GafferImage.Dilate ) :
+			for radius in self.__radii :
+				for masterChannel in ( "", "G" ) :
+					self.__assertMatchesBruteForce( image, nodeType, radius, masterChannel )
+
+	def testNaN( self ) :
+
+		# Tiles containing NaNs fall back to the brute force approach,
+		# and pixels whose neighbourhoods don't contain the NaN must be
+		# unaffected.
+		image = self.__randomImage( nanPixels = [ imath.V2i( 20, 30 ), imath.V2i( 70, 10 ) ] )
+		for nodeType in ( GafferImage.Median, GafferImage.Erode, GafferImage.Dilate ) :
+			for radius in self.__radii :
+				self.__assertMatchesBruteForce( image, nodeType, radius, "" )
+
+	def __randomImage( self, nanPixels ) :
+
+		# Values are quantised so that there are plenty of ties
+		# to exercise the tie breaking for master channels.
+		r = random.Random( 0 )
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 95, 79 ) )
+		image = IECoreImage.ImagePrimitive( dataWindow, dataWindow )
+		for channelName in ( "R", "G" ) :
+			values = [ math.floor( r.random() * 16 ) / 16.0 for i in range( 0, 96 * 80 ) ]
+			for p in nanPixels :
+				# Gaffer's y axis is flipped with respect to Cortex's.
+				values[(79-p.y)*96+p.x] = float( "nan" )
+			image[channelName] = IECore.FloatVectorData( values )
+
+		result = GafferImage.ObjectToImage()
+		result["object"].setValue( image )
+
+		return result
+
+	def __assertMatchesBruteForce( self, image, nodeType, radius, masterChannel ) :
+
+		node = nodeType()
+		node["in"].setInput( image["out"] )
+		node["radius"].setValue( radius )
+		node["masterChannel"].setValue( masterChannel )
+
+		dataWindow = image["out"]["dataWindow"].getValue()
+		inputBound = imath.Box2i( dataWindow.min() - radius, dataWindow.max() + radius )
+
+		offsets = [ imath.V2i( x, y ) for y in range( -radius.y, radius.y + 1 ) for x in range( -radius.x, radius.x + 1 ) ]
+
+		for channelName in ( "R", "G" ) :
+
+			inSampler = GafferImage.Sampler( image["out"], channelName, inputBound )
+			masterSampler = GafferImage.Sampler( image["out"], masterChannel or channelName, inputBound )
+			outSampler = GafferImage.Sampler( node["out"], channelName, dataWindow )
+
+			for y in range( dataWindow.min().y, dataWindow.max().y, 5 ) :
+				for x in range( dataWindow.min().x, dataWindow.max().x, 3 ) :
+
+					values = [ masterSampler.sample( x + o.x, y + o.y ) for o in offsets ]
+					if nodeType is GafferImage.Median :
+						if any( math.isnan( v ) for v in values ) :
+							# No well defined result
+							continue
+						rankValue = sorted( values )[len(values)//2]
+					elif nodeType is GafferImage.Erode :
+						rankValue = self.__minElement( values )
+					else :
+						rankValue = self.__maxElement( values )
+
+					if not masterChannel :
+						expected = rankValue
+					else :
+						# Take the closest offset matching the rank, using the
+						# same distance metric as RankFilter.
+						closest = min(
+							( o for o, v in zip( offsets, values ) if v == rankValue ),
+							key = lambda o : 100 * max( abs( o.x ), abs( o.y ) ) + abs( o.x ) + abs( o.y )
+						)
+						expected = inSampler.sample( x + closest.x, y + closest.y )
+
+					actual = outSampler.sample( x, y )
+					if math.isnan( expected ) :
+						self.assertTrue( math.isnan( actual ) )
+					else :
+						self.assertEqual(
+							actual, expected,
+							"{0} radius {1} masterChannel \"{2}\" channel {3} pixel {4}".format(
+								nodeType.__name__, radius, masterChannel, channelName, imath.V2i( x, y )
+							)
+						)
+
+	# Equivalents of `std::min_element()` and `std::max_element()`, which
+	# behave differently to Python's `min()` and `max()` in the presence of
+	# NaNs.
+
+	@staticmethod
+	def __minElement( values ) :
+
+		result = values[0]
+		for v in values[1:] :
+			if v < result :
+				result = v
+		return result
+
+	@staticmethod
+	def __maxElement( values ) :
+
+		result = values[0]
+		for v in values[1:] :
+			if result < v :
+				result = v
+		return result
+
+if __name__ == "__main__":
+	unittest.main()
@@ -209,6 +209,21 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"readAhead" : [
+
+			"description",
+			"""
+			The number of additional blocks of the image to read
+			in the background, ahead of the block currently being
+			read. This can hide file access latency, particularly
+			on network storage, when the image is accessed in order
+			- for instance by an ImageWriter. Read-ahead blocks are
+			read together in a single file access. A value of 0
+			disables read-ahead.
+			""",
+
+		],
+
 	}
 
 )
@@ -58,8 +58,9 @@ Gaffer.Metadata.registerNode(
 	"description",
 	"""
 	Calculates minimum, maximum and average colours for a region of
-	an image. These outputs can then be used to drive other plugs
-	within the node graph.
+	an image, along with a histogram and percentile for each channel.
+	These outputs can then be used to drive other plugs within the
+	node graph.
 	""",
 
 	plugs = {
@@ -123,6 +124,64 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"histogramBins" : [
+
+			"description",
+			"""
+			The number of bins used when computing the histogram.
+			""",
+
+			"nodule:type", "",
+
+		],
+
+		"histogramRange" : [
+
+			"description",
+			"""
+			The range of values covered by the histogram. Values outside
+			this range are counted in the first or last bin.
+			""",
+
+			"nodule:type", "",
+
+		],
+
+		"percentile" : [
+
+			"description",
+			"""
+			The percentile to be output by the percentileValue plug, in the
+			range 0-100. A value of 50 computes the median.
+			""",
+
+			"nodule:type", "",
+
+		],
+
+		"histogram" : [
+
+			"description",
+			"""
+			The per-channel histograms computed from the input image region.
+			Each child holds the number of pixels falling into each bin.
+			""",
+
+			"nodule:type", "",
+
+		],
+
+		"percentileValue" : [
+
+			"description",
+			"""
+			The per-channel values at the requested percentile. These are
+			interpolated from the histogram, so their accuracy depends on
+			the histogramBins and histogramRange settings.
+			""",
+
+		],
+
 	}
 
 )
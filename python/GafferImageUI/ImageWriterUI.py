@@ -115,6 +115,19 @@ Gaffer.Metadata.registerNode(
 			"plugValueWidget:type", "GafferUI.PresetsPlugValueWidget",
 		],
 
+		"cropToFormat" : [
+
+			"description",
+			"""
+			Writes only the part of the image that lies inside
+			the display window defined by the format. Pixels
+			in any overscan outside the display window are not
+			computed, which can save significant time when the
+			data window is much larger than the format.
+			""",
+
+		],
+
 		"out" : [
 
 			"description",
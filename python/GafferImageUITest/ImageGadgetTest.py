@@ -100,6 +100,63 @@ class ImageGadgetTest( GafferUITest.TestCase ) :
 		del g, w
 		del s
 
+	def testOnlyVisibleTilesAreComputed( self ) :
+
+		c = GafferImage.Checkerboard()
+		c["format"].setValue( GafferImage.Format( 4096, 4096 ) )
+
+		g = GafferImageUI.ImageGadget()
+		g.setImage( c["out"] )
+
+		with GafferUI.Window() as w :
+			gw = GafferUI.GadgetWidget( g )
+
+		viewport = gw.getViewportGadget()
+		tileSize = GafferImage.ImagePlug.tileSize()
+		numChannels = len( c["out"]["channelNames"].getValue() )
+
+		def visibleTiles() :
+
+			# Mirrors `ImageGadget::visibleRegion()`, padding the
+			# visible bound by a tile on each side.
+			bound = imath.Box2f()
+			size = imath.V2f( viewport.getViewport() )
+			for corner in ( imath.V2f( 0 ), imath.V2f( size.x, 0 ), imath.V2f( 0, size.y ), size ) :
+				p = viewport.rasterToGadgetSpace( corner, g ).p0
+				bound.extendBy( imath.V2f( p.x, p.y ) )
+
+			region = imath.Box2i(
+				GafferImage.ImagePlug.tileOrigin( imath.V2i( int( bound.min().x ), int( bound.min().y ) ) - imath.V2i( tileSize + 1 ) ),
+				imath.V2i( int( bound.max().x ), int( bound.max().y ) ) + imath.V2i( tileSize + 1 )
+			)
+			region = GafferImage.BufferAlgo.intersection( region, imath.Box2i( imath.V2i( 0 ), imath.V2i( 4096 ) ) )
+
+			return (
+				( ( region.max().x - region.min().x + tileSize - 1 ) // tileSize ) *
+				( ( region.max().y - region.min().y + tileSize - 1 ) // tileSize )
+			)
+
+		def assertOnlyVisibleTilesComputed( box ) :
+
+			Gaffer.ValuePlug.clearCache()
+			with Gaffer.PerformanceMonitor() as m :
+				viewport.frame( box )
+				self.waitForIdle( 1000 )
+
+			computeCount = m.plugStatistics( c["out"]["channelData"] ).computeCount
+			self.assertGreater( computeCount, 0 )
+			self.assertLessEqual( computeCount, visibleTiles() * numChannels )
+			self.assertLess( computeCount, ( 4096 // tileSize ) ** 2 * numChannels // 4 )
+
+		w.setVisible( True )
+
+		# Zoom into a small region near the middle of the image.
+		assertOnlyVisibleTilesComputed( imath.Box3f( imath.V3f( 1900, 1900, 0 ), imath.V3f( 2200, 2200, 0 ) ) )
+		# Pan to a region in the corner.
+		assertOnlyVisibleTilesComputed( imath.Box3f( imath.V3f( 100, 100, 0 ), imath.V3f( 400, 400, 0 ) ) )
+
+		del g, w
+
 if __name__ == "__main__":
 	unittest.main()
 
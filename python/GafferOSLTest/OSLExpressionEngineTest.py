@@ -43,6 +43,7 @@ import imath
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferDispatch
 import GafferDispatchTest
 import GafferOSL
@@ -607,5 +608,42 @@ class OSLExpressionEngineTest( GafferOSLTest.OSLTestCase ) :
 			c["str"] = "abc"
 			self.assertEqual( s["n"]["user"]["i"].getValue(), 1 )
 
+	def testChainedExpressions( self ) :
+
+		# The second expression is evaluated while the first is
+		# still executing, so they can't share a shading context.
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		for name in ( "a", "b", "c" ) :
+			s["n"]["user"][name] = Gaffer.FloatPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		s["e1"] = Gaffer.Expression()
+		s["e1"].setExpression( "parent.n.user.b = parent.n.user.a * 2;", "OSL" )
+
+		s["e2"] = Gaffer.Expression()
+		s["e2"].setExpression( "parent.n.user.c = parent.n.user.b + time;", "OSL" )
+
+		with Gaffer.Context() as c :
+			for i in range( 0, 10 ) :
+				c.setTime( i )
+				s["n"]["user"]["a"].setValue( i )
+				self.assertEqual( s["n"]["user"]["c"].getValue(), i * 3 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformance( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = Gaffer.Node()
+		s["n"]["user"]["f"] = Gaffer.FloatPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( "parent.n.user.f = time * 2;", "OSL" )
+
+		with Gaffer.Context() as c :
+			for i in range( 0, 100000 ) :
+				c.setFrame( i )
+				s["n"]["user"]["f"].getValue()
+
 if __name__ == "__main__":
 	unittest.main()
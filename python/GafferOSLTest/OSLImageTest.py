@@ -421,5 +421,35 @@ class OSLImageTest( GafferOSLTest.OSLTestCase ) :
 		self.assertNotIn( "image:tileOrigin", cs.variableNames() )
 		self.assertNotIn( "image:channelName", cs.variableNames() )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformance( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 4096, 2160 ) )
+
+		globals = GafferOSL.OSLShader()
+		globals.loadShader( "Utility/Globals" )
+
+		outU = GafferOSL.OSLShader()
+		outU.loadShader( "ImageProcessing/OutChannel" )
+		outU["parameters"]["channelName"].setValue( "R" )
+		outU["parameters"]["channelValue"].setInput( globals["out"]["globalU"] )
+
+		outV = GafferOSL.OSLShader()
+		outV.loadShader( "ImageProcessing/OutChannel" )
+		outV["parameters"]["channelName"].setValue( "G" )
+		outV["parameters"]["channelValue"].setInput( globals["out"]["globalV"] )
+
+		imageShader = GafferOSL.OSLShader()
+		imageShader.loadShader( "ImageProcessing/OutImage" )
+		imageShader["parameters"]["in0"].setInput( outU["out"]["channel"] )
+		imageShader["parameters"]["in1"].setInput( outV["out"]["channel"] )
+
+		image = GafferOSL.OSLImage()
+		image["in"].setInput( constant["out"] )
+		image["shader"].setInput( imageShader["out"] )
+
+		GafferImageTest.processTiles( image["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -819,6 +819,38 @@ class OSLObjectTest( GafferOSLTest.OSLTestCase ) :
 		assertContextCompatibility( False, envVar = "?" )
 		assertContextCompatibility( False, envVar = "1" )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformance( self ) :
+
+		p = GafferScene.Plane()
+		p["divisions"].setValue( imath.V2i( 1000 ) )
+
+		inPoint = GafferOSL.OSLShader()
+		inPoint.loadShader( "ObjectProcessing/InPoint" )
+
+		outPoint = GafferOSL.OSLShader()
+		outPoint.loadShader( "ObjectProcessing/OutPoint" )
+		outPoint["parameters"]["value"].setInput( inPoint["out"]["value"] )
+
+		outFloat = GafferOSL.OSLShader()
+		outFloat.loadShader( "ObjectProcessing/OutFloat" )
+		outFloat["parameters"]["name"].setValue( "f" )
+
+		outObject = GafferOSL.OSLShader()
+		outObject.loadShader( "ObjectProcessing/OutObject" )
+		outObject["parameters"]["in0"].setInput( outPoint["out"]["primitiveVariable"] )
+		outObject["parameters"]["in1"].setInput( outFloat["out"]["primitiveVariable"] )
+
+		f = GafferScene.PathFilter()
+		f["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		o = GafferOSL.OSLObject()
+		o["in"].setInput( p["out"] )
+		o["shader"].setInput( outObject["out"] )
+		o["filter"].setInput( f["out"] )
+
+		o["out"].object( "/plane" )
+
 if __name__ == "__main__":
 	unittest.main()
 
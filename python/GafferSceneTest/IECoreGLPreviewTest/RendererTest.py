@@ -226,5 +226,116 @@ class RendererTest( GafferTest.TestCase ) :
 
 		del o
 
+	def testQueryPendingEdits( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"OpenGL",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+		self.assertEqual( renderer.command( "gl:queryPendingEdits", {} ), IECore.BoolData( False ) )
+
+		o = renderer.object(
+			"/sphere",
+			IECoreScene.SpherePrimitive(),
+			renderer.attributes( IECore.CompoundObject() )
+		)
+		self.assertEqual( renderer.command( "gl:queryPendingEdits", {} ), IECore.BoolData( True ) )
+
+		# Querying the bound applies all pending edits.
+		renderer.command( "gl:queryBound", {} )
+		self.assertEqual( renderer.command( "gl:queryPendingEdits", {} ), IECore.BoolData( False ) )
+
+		del o
+
+	def testEditAttributesAfterGrouping( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create( "OpenGL" )
+
+		fragmentSource = """
+		uniform vec3 colorValue;
+		void main()
+		{
+			gl_FragColor = vec4( colorValue, 1 );
+		}
+		"""
+
+		def attributes( color ) :
+
+			return renderer.attributes(
+				IECore.CompoundObject( {
+					"gl:surface" : IECoreScene.ShaderNetwork(
+						shaders = {
+							"output" : IECoreScene.Shader(
+								"color",
+								"surface",
+								{
+									"gl:fragmentSource" : fragmentSource,
+									"colorValue" : color
+								}
+							)
+						},
+						output = "output"
+					)
+				} )
+			)
+
+		redAttributes = attributes( imath.Color3f( 1, 0, 0 ) )
+		greenAttributes = attributes( imath.Color3f( 0, 1, 0 ) )
+
+		# All three spheres share the same attributes, and
+		# are therefore rendered as a single group.
+
+		spheres = []
+		for x in ( -1, 0, 1 ) :
+			o = renderer.object( "/sphere{0}".format( x + 1 ), IECoreScene.SpherePrimitive(), redAttributes )
+			o.transform( imath.M44f().translate( imath.V3f( x, 0, -5 ) ) )
+			spheres.append( o )
+
+		def render( fileName ) :
+
+			fileName = os.path.join( self.temporaryDirectory(), fileName )
+			renderer.output( "test", IECoreScene.Output( fileName, "exr", "rgba", {} ) )
+			renderer.render()
+
+			image = IECore.Reader.create( fileName ).read()
+			dimensions = image.dataWindow.size() + imath.V2i( 1 )
+			row = dimensions.x * int( dimensions.y * 0.5 )
+			return [
+				imath.Color3f( image["R"][i], image["G"][i], image["B"][i] )
+				for i in ( row, row + int( dimensions.x * 0.5 ), row + dimensions.x - 1 )
+			]
+
+		red = imath.Color3f( 1, 0, 0 )
+		green = imath.Color3f( 0, 1, 0 )
+
+		self.assertEqual( render( "grouped.exr" ), [ red, red, red ] )
+
+		# Editing the attributes of the middle sphere after the groups were
+		# built means it must be rendered separately from its group.
+
+		spheres[1].attributes( greenAttributes )
+		self.assertEqual( render( "edited.exr" ), [ red, green, red ] )
+
+		# And after that, the groups are rebuilt to include the edit.
+
+		self.assertEqual( render( "regrouped.exr" ), [ red, green, red ] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManySmallObjectsPerformance( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create( "OpenGL" )
+		renderer.output( "test", IECoreScene.Output( self.temporaryDirectory() + "/testManySmallObjects.exr", "exr", "rgba", {} ) )
+
+		attributes = renderer.attributes( IECore.CompoundObject() )
+		plane = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -0.005 ), imath.V2f( 0.005 ) ) )
+
+		objects = []
+		for i in range( 0, 10000 ) :
+			o = renderer.object( "/plane{0}".format( i ), plane, attributes )
+			o.transform( imath.M44f().translate( imath.V3f( ( i % 100 ) * 0.01 - 0.5, ( i // 100 ) * 0.01 - 0.5, -5 ) ) )
+			objects.append( o )
+
+		renderer.render()
+
 if __name__ == "__main__":
 	unittest.main()
@@ -409,6 +409,84 @@ class DependencyNodeTest( GafferTest.TestCase ) :
 
 		f1["in"][0].setValue( 10 )
 
+	def testDirtyPropagationFollowsRewiring( self ) :
+
+		n1 = GafferTest.AddNode()
+		n2 = GafferTest.AddNode()
+		n3 = GafferTest.AddNode()
+
+		n2["op1"].setInput( n1["sum"] )
+
+		cs2 = GafferTest.CapturingSlot( n2.plugDirtiedSignal() )
+		cs3 = GafferTest.CapturingSlot( n3.plugDirtiedSignal() )
+
+		n1["op1"].setValue( 1 )
+		self.assertEqual( { x[0].getName() for x in cs2 }, { "op1", "sum" } )
+		self.assertEqual( len( cs3 ), 0 )
+
+		# Dirtiness must follow the new connections, and
+		# not those which were in place last time.
+
+		n2["op1"].setInput( None )
+		n3["op2"].setInput( n1["sum"] )
+
+		del cs2[:]
+		del cs3[:]
+
+		n1["op1"].setValue( 2 )
+		self.assertEqual( len( cs2 ), 0 )
+		self.assertEqual( { x[0].getName() for x in cs3 }, { "op2", "sum" } )
+
+	def testAffectsResultsAreCached( self ) :
+
+		class CountingNode( Gaffer.DependencyNode ) :
+
+			affectsCalls = 0
+
+			def __init__( self, name = "CountingNode" ) :
+
+				Gaffer.DependencyNode.__init__( self, name )
+
+				self["in"] = Gaffer.IntPlug()
+				self["out"] = Gaffer.IntPlug( direction = Gaffer.Plug.Direction.Out )
+
+			def affects( self, input ) :
+
+				CountingNode.affectsCalls += 1
+
+				result = Gaffer.DependencyNode.affects( self, input )
+				if input.isSame( self["in"] ) :
+					result.append( self["out"] )
+
+				return result
+
+		# Enough nodes that the cache holds more entries
+		# than any plausible limit on its size.
+
+		source = GafferTest.AddNode()
+		nodes = []
+		for i in range( 0, 10000 ) :
+			n = CountingNode()
+			n["in"].setInput( source["sum"] )
+			nodes.append( n )
+
+		source["op1"].setValue( 1 )
+		self.assertGreaterEqual( CountingNode.affectsCalls, 10000 )
+
+		# The graph hasn't changed, so the results
+		# of `affects()` can be reused.
+
+		CountingNode.affectsCalls = 0
+		source["op1"].setValue( 2 )
+		self.assertEqual( CountingNode.affectsCalls, 0 )
+
+		# But rewiring the graph must invalidate them.
+
+		nodes[0]["in"].setInput( None )
+		CountingNode.affectsCalls = 0
+		source["op1"].setValue( 3 )
+		self.assertGreaterEqual( CountingNode.affectsCalls, 9999 )
+
 	def testDirtyPropagationScoping( self ) :
 
 		s = Gaffer.ScriptNode()
@@ -60,5 +60,53 @@ class DirtyPropagationScopeTest( GafferTest.TestCase ) :
 
 		self.assertEqual( len( [ x[0] for x in cs if x[0].isSame( n["sum"] ) ] ), 1 )
 
+	def testBulkEdits( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["source"] = GafferTest.AddNode()
+
+		for i in range( 0, 10 ) :
+			s["add%d" % i] = GafferTest.AddNode()
+			s["add%d" % i]["op1"].setInput( s["source"]["sum"] )
+
+		cs = GafferTest.CapturingSlot( s["add0"].plugDirtiedSignal() )
+
+		with Gaffer.DirtyPropagationScope() :
+
+			for i in range( 0, 100 ) :
+				s["source"]["op1"].setValue( i + 1 )
+				for j in range( 0, 10 ) :
+					s["add%d" % j]["op2"].setValue( i + 1 )
+
+			# Nothing is signalled until the scope closes.
+			self.assertEqual( len( cs ), 0 )
+
+		# And then each plug is only signalled once.
+		self.assertEqual(
+			sorted( x[0].getName() for x in cs ),
+			[ "op1", "op2", "sum" ]
+		)
+
+	def testRewiringWithinScope( self ) :
+
+		n1 = GafferTest.AddNode()
+		n2 = GafferTest.AddNode()
+		n3 = GafferTest.AddNode()
+
+		n2["op1"].setInput( n1["sum"] )
+
+		cs2 = GafferTest.CapturingSlot( n2.plugDirtiedSignal() )
+		cs3 = GafferTest.CapturingSlot( n3.plugDirtiedSignal() )
+
+		with Gaffer.DirtyPropagationScope() :
+
+			n1["op1"].setValue( 10 )
+			n2["op1"].setInput( None )
+			n3["op1"].setInput( n1["sum"] )
+			n1["op2"].setValue( 10 )
+
+		self.assertEqual( [ x[0].getName() for x in cs2 if x[0].getName() == "sum" ], [ "sum" ] )
+		self.assertEqual( [ x[0].getName() for x in cs3 if x[0].getName() == "sum" ], [ "sum" ] )
+
 if __name__ == "__main__":
 	unittest.main()
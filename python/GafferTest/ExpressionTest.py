@@ -1416,5 +1416,79 @@ class ExpressionTest( GafferTest.TestCase ) :
 			self.assertEqual( s["n"]["op1"].getValue(), 0 )
 			self.assertEqual( s["n"]["op2"].getValue(), 1 )
 
+	def testNativeExecution( self ) :
+
+		def values( expression, native ) :
+
+			env = os.environ.copy()
+			os.environ["GAFFER_NATIVE_PYTHON_EXPRESSIONS"] = "1" if native else "0"
+			try :
+				s = Gaffer.ScriptNode()
+				s["n"] = Gaffer.Node()
+				for name, plugType, defaultValue in ( ( "i", Gaffer.IntPlug, 3 ), ( "f", Gaffer.FloatPlug, 3.0 ), ( "b", Gaffer.BoolPlug, True ) ) :
+					s["n"]["user"][name] = plugType( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+					s["n"]["user"][name+"In"] = plugType( defaultValue = defaultValue, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+				s["e"] = Gaffer.Expression()
+				s["e"].setExpression( expression )
+			finally :
+				os.environ.clear()
+				os.environ.update( env )
+
+			result = []
+			with Gaffer.Context() as c :
+				c["i"] = 5
+				c["f"] = 2.5
+				for frame in range( -2, 3 ) :
+					c.setFrame( frame )
+					result.append( [ s["n"]["user"][n].getValue() for n in ( "i", "f", "b" ) ] )
+
+			return result
+
+		for expression in [
+			'parent["n"]["user"]["i"] = -7 / 2',
+			'parent["n"]["user"]["i"] = 7 / -2 + 7 / 2',
+			'parent["n"]["user"]["i"] = context.getFrame() * 2.5',
+			'parent["n"]["user"]["f"] = context.getFrame() * 2 + parent["n"]["user"]["fIn"]',
+			'parent["n"]["user"]["f"] = context.getTime() - context.getFramesPerSecond() / 4',
+			'parent["n"]["user"]["i"] = context["i"] * 3 - True',
+			'parent["n"]["user"]["f"] = context.get( "f" ) / parent["n"]["user"]["iIn"]',
+			'parent["n"]["user"]["i"] = parent["n"]["user"]["iIn"] / 2\nparent["n"]["user"]["f"] = -parent["n"]["user"]["bIn"]',
+			'parent["n"]["user"]["b"] = parent["n"]["user"]["bIn"]',
+			'parent["n"]["user"]["b"] = False',
+			'parent["n"]["user"]["f"] = 10 / ( context.getFrame() + 3 )',
+			# Intermediate results which overflow 64 bit integers.
+			'parent["n"]["user"]["i"] = ( 9223372036854775807 + context["i"] ) - 9223372036854775807',
+			'parent["n"]["user"]["i"] = ( -9223372036854775807 - context["i"] ) + 9223372036854775807',
+			'parent["n"]["user"]["i"] = ( 4611686018427387904 * context["i"] ) / 4611686018427387904',
+			'parent["n"]["user"]["i"] = -( -9223372036854775807 - 1 ) / 9223372036854775807',
+			'parent["n"]["user"]["i"] = ( -9223372036854775807 - 1 ) / -1 / 9223372036854775807',
+		] :
+			self.assertEqual( values( expression, native = True ), values( expression, native = False ), expression )
+
+		# Errors must be the same too.
+
+		for expression in [
+			'parent["n"]["user"]["i"] = 1 / context.getFrame()',
+			'parent["n"]["user"]["i"] = context["iDontExist"]',
+			# Overflowed results that would wrap into the range of `int`.
+			'parent["n"]["user"]["i"] = 9223372036854775807 * 2 + context["i"]',
+			'parent["n"]["user"]["i"] = 4294967296 * 4294967296 + context["i"]',
+		] :
+			for native in ( True, False ) :
+				self.assertRaises( Exception, values, expression, native )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSimpleExpressionPerformance( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.AddNode()
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( 'parent["n"]["op1"] = context.getFrame() * 2' )
+
+		with Gaffer.Context() as c :
+			for i in range( 0, 100000 ) :
+				c.setFrame( i )
+				s["n"]["sum"].getValue()
+
 if __name__ == "__main__":
 	unittest.main()
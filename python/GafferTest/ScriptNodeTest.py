@@ -45,6 +45,8 @@ import stat
 import inspect
 import functools
 
+import imath
+
 import IECore
 
 import Gaffer
@@ -1464,5 +1466,148 @@ class ScriptNodeTest( GafferTest.TestCase ) :
 		s["fileName"].setValue( self.temporaryDirectory() + "/test2.gfr" )
 		self.assertFalse( Gaffer.MetadataAlgo.getReadOnly( s ) )
 
+	def testNativeExecution( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n1"] = GafferTest.AddNode()
+		s["n2"] = GafferTest.AddNode()
+		s["n2"]["op1"].setInput( s["n1"]["sum"] )
+
+		s["n1"]["user"]["b"] = Gaffer.BoolPlug( defaultValue = True, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n1"]["user"]["f"] = Gaffer.FloatPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n1"]["user"]["s"] = Gaffer.StringPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n1"]["user"]["v"] = Gaffer.V3fPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n1"]["user"]["c"] = Gaffer.Color4fPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n1"]["user"]["i"] = Gaffer.V2iPlug( flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+		s["n1"]["user"]["d"] = Gaffer.StringVectorDataPlug( defaultValue = IECore.StringVectorData(), flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic )
+
+		s["n1"]["op1"].setValue( 10 )
+		s["n1"]["user"]["b"].setValue( False )
+		s["n1"]["user"]["f"].setValue( -1.5e-10 )
+		s["n1"]["user"]["s"].setValue( "it's a \"test\"\n\twith\\escapes" )
+		s["n1"]["user"]["v"].setValue( imath.V3f( 1, 2.5, -3 ) )
+		s["n1"]["user"]["c"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+		s["n1"]["user"]["i"].setValue( imath.V2i( 2048, 1024 ) )
+		s["n1"]["user"]["d"].setValue( IECore.StringVectorData( [ "a", "b" ] ) )
+
+		Gaffer.Metadata.registerValue( s["n1"], "description", "A \"node\"" )
+		Gaffer.Metadata.registerValue( s["n1"]["op1"], "readOnly", True )
+		Gaffer.Metadata.registerValue( s["n1"]["op2"], "nodule:color", imath.Color3f( 1, 0, 0 ) )
+
+		serialisation = s.serialise()
+
+		def assertLoaded( s2 ) :
+
+			self.assertTrue( s2["n2"]["op1"].getInput().isSame( s2["n1"]["sum"] ) )
+			for plug in [ s["n1"]["op1"] ] + s["n1"]["user"].children() :
+				self.assertEqual( s2.descendant( plug.relativeName( s ) ).getValue(), plug.getValue() )
+
+			self.assertEqual( Gaffer.Metadata.value( s2["n1"], "description" ), 'A "node"' )
+			self.assertEqual( Gaffer.Metadata.value( s2["n1"]["op1"], "readOnly" ), True )
+			self.assertEqual( Gaffer.Metadata.value( s2["n1"]["op2"], "nodule:color" ), imath.Color3f( 1, 0, 0 ) )
+
+		s2 = Gaffer.ScriptNode()
+		s2.execute( serialisation )
+		assertLoaded( s2 )
+
+		# Compare against pure python execution.
+
+		os.environ["GAFFER_NATIVE_SCRIPT_EXECUTION"] = "0"
+		try :
+			s3 = Gaffer.ScriptNode()
+			s3.execute( serialisation )
+			assertLoaded( s3 )
+		finally :
+			del os.environ["GAFFER_NATIVE_SCRIPT_EXECUTION"]
+
+	def testNativeExecutionErrors( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.AddNode()
+
+		script = inspect.cleandoc(
+			"""
+			parent["n"]["op1"].setValue( 1 )
+			parent["n"]["iDontExist"].setValue( 2 )
+			if True :
+				parent["n"]["op2"].setValue( 3 )
+			parent["n"]["op1"].setValue( 'notAnInt' )
+			parent["n"]["op1"].setValue( 4 )
+			"""
+		)
+
+		with IECore.CapturingMessageHandler() as mh :
+			self.assertTrue( s.execute( script, continueOnError = True ) )
+
+		self.assertEqual( s["n"]["op1"].getValue(), 4 )
+		self.assertEqual( s["n"]["op2"].getValue(), 3 )
+
+		self.assertEqual( len( mh.messages ), 2 )
+		self.assertEqual( mh.messages[0].context, "Line 2" )
+		self.assertEqual( mh.messages[1].context, "Line 5" )
+
+		self.assertRaisesRegexp( RuntimeError, "Line 2 .*iDontExist", s.execute, script )
+
+	def testPartialLoad( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n1"] = GafferTest.AddNode()
+		s["n2"] = GafferTest.AddNode()
+		s["n2"]["op1"].setInput( s["n1"]["sum"] )
+		s["n3"] = GafferTest.AddNode()
+		s["n3"]["op1"].setValue( 10 )
+		s["n4"] = GafferTest.AddNode()
+		s["n4"]["op1"].setValue( 20 )
+
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( 'parent["n1"]["op1"] = parent["n3"]["sum"]' )
+
+		# An unrelated Reference, whose file we'll make unavailable
+		# so that we know it isn't loaded.
+
+		referenceScript = Gaffer.ScriptNode()
+		referenceScript["b"] = Gaffer.Box()
+		referenceScript["b"]["n"] = GafferTest.AddNode()
+		referenceFileName = self.temporaryDirectory() + "/test.grf"
+		referenceScript["b"].exportForReference( referenceFileName )
+
+		s["r"] = Gaffer.Reference()
+		s["r"].load( referenceFileName )
+
+		s["fileName"].setValue( self.temporaryDirectory() + "/test.gfr" )
+		s.save()
+
+		os.rename( referenceFileName, referenceFileName + ".unavailable" )
+
+		s2 = Gaffer.ScriptNode()
+		s2["fileName"].setValue( s["fileName"].getValue() )
+		s2.load( nodes = [ "n2" ] )
+
+		self.assertIn( "n1", s2 )
+		self.assertIn( "n2", s2 )
+		self.assertIn( "n3", s2 )
+		self.assertIn( "e", s2 )
+		self.assertNotIn( "n4", s2 )
+		self.assertNotIn( "r", s2 )
+
+		# But a full load does try to load the Reference.
+
+		s3 = Gaffer.ScriptNode()
+		s3["fileName"].setValue( s["fileName"].getValue() )
+		self.assertRaises( Exception, s3.load )
+
+		os.rename( referenceFileName + ".unavailable", referenceFileName )
+
+		self.assertTrue( s2["n2"]["op1"].getInput().isSame( s2["n1"]["sum"] ) )
+		self.assertEqual( s2["n2"]["sum"].getValue(), 10 )
+
+		self.assertRaisesRegexp( RuntimeError, "partially loaded", s2.save )
+
+		# A full load makes the script saveable again.
+
+		s2.load()
+		self.assertIn( "n4", s2 )
+		s2.save()
+
 if __name__ == "__main__":
 	unittest.main()
@@ -621,6 +621,11 @@ class ValuePlugTest( GafferTest.TestCase ) :
 
 		GafferTest.testValuePlugContentionForOneItem()
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testDirtyPropagationPerformance( self ) :
+
+		GafferTest.testValuePlugDirtyPropagationPerformance()
+
 	def setUp( self ) :
 
 		GafferTest.TestCase.setUp( self )
@@ -51,6 +51,7 @@ class TractorDispatcher( GafferDispatch.Dispatcher ) :
 
 		self["service"] = Gaffer.StringPlug( defaultValue = '"*"' )
 		self["envKey"] = Gaffer.StringPlug()
+		self["partialLoad"] = Gaffer.BoolPlug( defaultValue = False )
 
 	## Emitted prior to spooling the Tractor job, to allow
 	# custom modifications to be applied.
@@ -77,6 +78,7 @@ class TractorDispatcher( GafferDispatch.Dispatcher ) :
 		dispatchData["scriptNode"] = rootBatch.preTasks()[0].node().scriptNode()
 		dispatchData["scriptFile"] = Gaffer.Context.current()["dispatcher:scriptFileName"]
 		dispatchData["batchesToTasks"] = {}
+		dispatchData["partialLoad"] = self["partialLoad"].getValue()
 
 		# Create a Tractor job and set its basic properties.
 
@@ -160,6 +162,9 @@ class TractorDispatcher( GafferDispatch.Dispatcher ) :
 				"-frames", frames,
 			]
 
+			if dispatchData["partialLoad"] :
+				args.append( "-partialLoad" )
+
 			scriptContext = dispatchData["scriptNode"].context()
 			contextArgs = []
 			for entry in [ k for k in batch.context().keys() if k != "frame" and not k.startswith( "ui:" ) ] :
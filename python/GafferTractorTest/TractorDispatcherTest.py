@@ -255,6 +255,21 @@ class TractorDispatcherTest( GafferTest.TestCase ) :
 		self.assertEqual( systemCommandTask.title, "systemCommand 1" )
 		self.assertEqual( len( systemCommandTask.cmds ), 1 )
 
+	def testPartialLoad( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferDispatchTest.LoggingTaskNode()
+
+		dispatcher = self.__dispatcher()
+		self.assertFalse( dispatcher["partialLoad"].getValue() )
+
+		job = self.__job( [ s["n"] ], dispatcher )
+		self.assertNotIn( "-partialLoad", job.subtasks[0].cmds[0].argv )
+
+		dispatcher["partialLoad"].setValue( True )
+		job = self.__job( [ s["n"] ], dispatcher )
+		self.assertIn( "-partialLoad", job.subtasks[0].cmds[0].argv )
+
 	def testImathContextVariable( self ) :
 
 		s = Gaffer.ScriptNode()
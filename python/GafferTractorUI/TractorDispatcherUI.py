@@ -82,6 +82,19 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"partialLoad" : [
+
+			"description",
+			"""
+			Loads only the nodes being executed and the nodes they depend on
+			when executing each task, rather than the whole script. This can
+			significantly reduce the time taken to start each task, but must
+			not be used if tasks access other nodes by name when they execute,
+			as those nodes may not be loaded.
+			""",
+
+		],
+
 	}
 
 )
@@ -337,5 +337,122 @@ class GadgetTest( GafferUITest.TestCase ) :
 		self.assertEqual( g3.enabled( relativeTo = g2 ), True )
 		self.assertEqual( g3.enabled( relativeTo = g1 ), True )
 
+	def testBoundUpdates( self ) :
+
+		g1 = GafferUI.Gadget()
+		g2 = GafferUI.Gadget()
+		g1.addChild( g2 )
+		t = GafferUI.TextGadget( "text" )
+		g2.addChild( t )
+
+		b = t.bound()
+		self.assertEqual( g1.bound(), b )
+		self.assertEqual( g1.renderBound(), b )
+
+		t.setTransform( imath.M44f().translate( imath.V3f( 10, 0, 0 ) ) )
+		self.assertEqual( g1.bound(), imath.Box3f( b.min() + imath.V3f( 10, 0, 0 ), b.max() + imath.V3f( 10, 0, 0 ) ) )
+
+		g2.removeChild( t )
+		self.assertEqual( g1.bound(), imath.Box3f() )
+
+		g2.addChild( t )
+		t.setText( "a much longer piece of text" )
+		self.assertEqual( g1.bound(), t.transformedBound() )
+
+		# Bounds computed in Python may change without any
+		# notification, and must still be reflected by the parent.
+
+		class VaryingBoundGadget( GafferUI.Gadget ) :
+
+			def __init__( self ) :
+
+				GafferUI.Gadget.__init__( self )
+				self.b = imath.Box3f( imath.V3f( 0 ), imath.V3f( 1 ) )
+
+			def bound( self ) :
+
+				return self.b
+
+		g2.removeChild( t )
+		v = VaryingBoundGadget()
+		g2.addChild( v )
+		self.assertEqual( g1.bound(), v.b )
+
+		v.b = imath.Box3f( imath.V3f( -1 ), imath.V3f( 2 ) )
+		self.assertEqual( g1.bound(), v.b )
+		self.assertEqual( g1.renderBound(), v.b )
+
+	def testCulling( self ) :
+
+		class RecordingGadget( GafferUI.Gadget ) :
+
+			def __init__( self, renderBound = None ) :
+
+				GafferUI.Gadget.__init__( self )
+				self.__renderBound = renderBound
+				self.layersRendered = set()
+
+			def bound( self ) :
+
+				return imath.Box3f( imath.V3f( 0, 0, 0 ), imath.V3f( 10, 10, 0 ) )
+
+			def renderBound( self ) :
+
+				if self.__renderBound is not None :
+					return self.__renderBound
+
+				return GafferUI.Gadget.renderBound( self )
+
+			def doRenderLayer( self, layer, style ) :
+
+				self.layersRendered.add( layer )
+				if layer == GafferUI.Gadget.Layer.Main :
+					style.renderSolidRectangle( imath.Box2f( imath.V2f( 0 ), imath.V2f( 10 ) ) )
+
+		onScreen = RecordingGadget()
+		offScreen = RecordingGadget()
+		offScreen.setTransform( imath.M44f().translate( imath.V3f( 10000, 0, 0 ) ) )
+
+		# A gadget which is off screen, but which draws on screen,
+		# and is nested in a parent which doesn't know that. This is
+		# the situation for nodules while a connection is being dragged
+		# from them.
+		offScreenDrawing = RecordingGadget( renderBound = imath.Box3f( imath.V3f( -10000, 0, 0 ), imath.V3f( 10, 10, 0 ) ) )
+		offScreenDrawingParent = GafferUI.Gadget()
+		offScreenDrawingParent.setTransform( imath.M44f().translate( imath.V3f( 10000, 0, 0 ) ) )
+		offScreenDrawingParent.addChild( offScreenDrawing )
+
+		container = GafferUI.Gadget()
+		for g in ( onScreen, offScreen, offScreenDrawingParent ) :
+			container.addChild( g )
+
+		viewport = GafferUI.ViewportGadget( container )
+		viewport.setPlanarMovement( True )
+
+		with GafferUI.Window() as w :
+			GafferUI.GadgetWidget( viewport )
+
+		w.setVisible( True )
+		self.waitForIdle( 1000 )
+
+		viewport.frame( onScreen.bound() )
+		self.waitForIdle( 1000 )
+
+		self.assertIn( GafferUI.Gadget.Layer.Main, onScreen.layersRendered )
+		self.assertIn( GafferUI.Gadget.Layer.Main, offScreenDrawing.layersRendered )
+		self.assertEqual( offScreen.layersRendered, set() )
+
+		# Gadgets off screen can't be selected, so shouldn't be
+		# rendered during selection either.
+
+		for g in ( onScreen, offScreen, offScreenDrawing ) :
+			g.layersRendered = set()
+
+		gadgets = viewport.gadgetsAt( viewport.gadgetToRasterSpace( imath.V3f( 5, 5, 0 ), onScreen ) )
+		self.assertEqual( len( gadgets ), 1 )
+		self.assertTrue( gadgets[0].isSame( onScreen ) )
+		self.assertIn( GafferUI.Gadget.Layer.Main, onScreen.layersRendered )
+		self.assertEqual( offScreen.layersRendered, set() )
+
 if __name__ == "__main__":
 	unittest.main()
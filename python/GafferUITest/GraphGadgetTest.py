@@ -1393,5 +1393,73 @@ class GraphGadgetTest( GafferUITest.TestCase ) :
 		self.assertEqual( c[0].dstNodule(), g.nodeGadget( s["n2"] ).nodule( s["n2"]["c"]["r"] ) )
 		self.assertIsNone( c[0].srcNodule() )
 
+	def testLowDetail( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.AddNode()
+
+		g = GafferUI.GraphGadget( s )
+		self.assertFalse( g.lowDetail() )
+
+		viewport = GafferUI.ViewportGadget( g )
+		viewport.setPlanarMovement( True )
+		viewport.setViewport( imath.V2i( 800, 600 ) )
+
+		viewport.frame( imath.Box3f( imath.V3f( -10, -10, 0 ), imath.V3f( 10, 10, 0 ) ) )
+		self.assertFalse( g.lowDetail() )
+
+		viewport.frame( imath.Box3f( imath.V3f( -1000, -1000, 0 ), imath.V3f( 1000, 1000, 0 ) ) )
+		self.assertTrue( g.lowDetail() )
+
+		viewport.frame( imath.Box3f( imath.V3f( -10, -10, 0 ), imath.V3f( 10, 10, 0 ) ) )
+		self.assertFalse( g.lowDetail() )
+
+		# Shrinking the viewport while keeping the same scale
+		# doesn't change the level of detail.
+
+		viewport.setViewport( imath.V2i( 400, 300 ) )
+		self.assertFalse( g.lowDetail() )
+
+		# Zooming out in a viewport the graph is no longer
+		# in doesn't affect it.
+
+		viewport.setPrimaryChild( None )
+		viewport.frame( imath.Box3f( imath.V3f( -1000, -1000, 0 ), imath.V3f( 1000, 1000, 0 ) ) )
+		self.assertFalse( g.lowDetail() )
+
+	def testLowDetailLine( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["n1"] = GafferTest.AddNode()
+		s["n2"] = GafferTest.AddNode()
+		s["n2"]["op1"].setInput( s["n1"]["sum"] )
+		s["n3"] = GafferTest.AddNode()
+
+		g = GafferUI.GraphGadget( s )
+		g.setNodePosition( s["n1"], imath.V2f( 0, 10 ) )
+		g.setNodePosition( s["n2"], imath.V2f( 5, 0 ) )
+
+		srcNodule = g.nodeGadget( s["n1"] ).nodule( s["n1"]["sum"] )
+		dstNodule = g.nodeGadget( s["n2"] ).nodule( s["n2"]["op1"] )
+
+		c = g.connectionGadget( s["n2"]["op1"] )
+		line = c.lowDetailLine()
+		self.assertEqual( len( line ), 4 )
+		self.assertEqual( line[0], imath.V3f( 0 ) * srcNodule.fullTransform( g ) )
+		self.assertEqual( line[1], imath.V3f( 0 ) * dstNodule.fullTransform( g ) )
+		self.assertEqual( line[2], GafferUI.Style.State.NormalState )
+		self.assertIsNone( line[3] )
+
+		# The state reflects highlighting of the nodes.
+
+		g.nodeGadget( s["n1"] ).setHighlighted( True )
+		self.assertEqual( c.lowDetailLine()[2], GafferUI.Style.State.HighlightedState )
+		g.nodeGadget( s["n1"] ).setHighlighted( False )
+
+		# And the line follows the nodes.
+
+		g.setNodePosition( s["n2"], imath.V2f( 20, -10 ) )
+		self.assertEqual( c.lowDetailLine()[1], imath.V3f( 0 ) * dstNodule.fullTransform( g ) )
+
 if __name__ == "__main__":
 	unittest.main()
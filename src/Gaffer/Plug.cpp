@@ -50,9 +50,13 @@
 #include "boost/graph/adjacency_list.hpp"
 #include "boost/graph/depth_first_search.hpp"
 #include "boost/unordered_map.hpp"
+#include "boost/unordered_set.hpp"
 
+#include "tbb/atomic.h"
 #include "tbb/enumerable_thread_specific.h"
 
+#include <unordered_map>
+
 using namespace boost;
 using namespace Gaffer;
 
@@ -100,6 +104,18 @@ bool allDescendantInputsAreNull( const Plug *plug )
 	return true;
 }
 
+// Incremented every time a change is made which might
+// alter the dependencies between plugs - connections
+// being made or broken, and plugs being added, removed
+// or destroyed. Used to invalidate the per-thread caches
+// of dependencies maintained by Plug::DirtyPlugs.
+tbb::atomic<uint64_t> g_dependencyGeneration;
+
+void dependenciesChanged()
+{
+	++g_dependencyGeneration;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -116,6 +132,7 @@ Plug::Plug( const std::string &name, Direction direction, unsigned flags )
 
 Plug::~Plug()
 {
+	dependenciesChanged();
 	setInputInternal( nullptr, false );
 	for( OutputContainer::iterator it=m_outputs.begin(); it!=m_outputs.end(); )
 	{
@@ -471,6 +488,10 @@ void Plug::setInput( PlugPtr input, bool setChildInputs, bool updateParentInput
 
 void Plug::setInputInternal( PlugPtr input, bool emit )
 {
+	// Any deferred dirtiness must be propagated using the
+	// connections that were in place when it was requested.
+	flushDirtyPropagationScope();
+	dependenciesChanged();
 	if( m_input )
 	{
 		m_input->m_outputs.remove( this );
@@ -622,6 +643,7 @@ void Plug::parentChanging( Gaffer::GraphComponent *newParent )
 	scriptNode = scriptNode ? scriptNode : ( newParent ? newParent->ancestor<ScriptNode>() : nullptr );
 	if( scriptNode && ( scriptNode->currentActionStage() == Action::Undo || scriptNode->currentActionStage() == Action::Redo ) )
 	{
+		flushDirtyPropagationScope();
 		return;
 	}
 
@@ -685,12 +707,19 @@ void Plug::parentChanging( Gaffer::GraphComponent *newParent )
 		}
 	}
 
+	// We're about to lose or gain a parent, which may change the
+	// results of DependencyNode::affects(), so propagate any
+	// deferred dirtiness while the old parent is still in place.
+	flushDirtyPropagationScope();
+
 }
 
 void Plug::parentChanged( Gaffer::GraphComponent *oldParent )
 {
 	GraphComponent::parentChanged( oldParent );
 
+	dependenciesChanged();
+
 	if( getFlags( Dynamic ) )
 	{
 		if( node() )
@@ -736,16 +765,34 @@ void Plug::propagateDirtinessForParentChange( Plug *plugToDirty )
 // Instead we collect all the dirty plugs in this container as we traverse
 // the graph and only when the traversal is complete do we emit the plugDirtiedSignal().
 //
+// Within a DirtyPropagationScope, we go one step further and also defer
+// the traversal itself, merely recording the plugs which were dirtied
+// directly. When the scope closes, a single combined traversal is made
+// from all of them. This is important for scripted bulk edits, where
+// many plugs are set in turn, and in the same way it is important for
+// the traversal to be made before any rewiring so that it sees the
+// graph as it was when the plugs were dirtied. Plug calls
+// flushDirtyPropagationScope() before any such rewiring.
+//
 // The container used is stored per-thread as although it's illegal to be
 // monkeying with a script from multiple threads, it's perfectly legal to
 // be monkeying with a different script in each thread.
+//
+// To avoid repeated calls to DependencyNode::affects() when the same part
+// of the graph is dirtied over and over again (when dragging a slider for
+// instance), we also cache the direct dependents of each plug we visit.
+// This cache is discarded wholesale whenever g_dependencyGeneration tells
+// us that the graph has been rewired. Its size is therefore bounded by
+// the number of plugs in the graph, and it needs no other limit. This
+// relies on affects() depending only on the structure of the graph and
+// not on plug values, as documented for DependencyNode::affects().
 class Plug::DirtyPlugs
 {
 
 	public :
 
 		DirtyPlugs()
-			:	m_scopeCount( 0 ), m_emitting( false )
+			:	m_scopeCount( 0 ), m_emitting( false ), m_dependentsGeneration( g_dependencyGeneration )
 		{
 		}
 
@@ -756,31 +803,39 @@ class Plug::DirtyPlugs
 				return;
 			}
 
-			if( !insertVertex( plugToDirty ).second )
+			if( !plugToDirty->refCount() )
 			{
-				// Previously inserted, so we'll already
-				// have visited the dependents.
+				// Still being constructed (see SplinePlug comment in
+				// insertVertex()), so there's no point signalling
+				// dirtiness, and we mustn't take a reference.
 				return;
 			}
 
-			for( DownstreamIterator it( plugToDirty ); !it.done(); ++it )
+			if( m_pendingPlugs.insert( plugToDirty ).second )
 			{
-				InsertedVertex v = insertVertex( &*it );
-				if( !it->getFlags( Plug::AcceptsDependencyCycles ) )
-				{
-					add_edge(
-						v.first,
-						insertVertex( it.upstream() ).first,
-						m_graph
-					);
-				}
+				m_pending.push_back( plugToDirty );
+			}
+		}
 
-				if( !v.second )
-				{
-					// Already visited this plug by another path,
-					// so we can prune the iteration.
-					it.prune();
-				}
+		// Traverses the graph downstream of all plugs recorded by
+		// insert(), adding everything that is dirtied to m_graph.
+		void flush()
+		{
+			if( m_pending.empty() )
+			{
+				return;
+			}
+
+			// Take ownership of the pending plugs, in case the traversal
+			// triggers a reentrant flush (via calls to python in
+			// DependencyNode::affects() for instance).
+			std::vector<PlugPtr> pending;
+			pending.swap( m_pending );
+			m_pendingPlugs.clear();
+
+			for( const auto &plug : pending )
+			{
+				traverse( plug.get() );
 			}
 		}
 
@@ -796,6 +851,7 @@ class Plug::DirtyPlugs
 			{
 				if( !m_emitting ) // see comment in emit()
 				{
+					flush();
 					emit();
 				}
 			}
@@ -809,6 +865,61 @@ class Plug::DirtyPlugs
 
 	private :
 
+		void traverse( const Plug *plugToDirty )
+		{
+			const uint64_t generation = g_dependencyGeneration;
+			if( generation != m_dependentsGeneration )
+			{
+				m_dependents.clear();
+				m_dependentsGeneration = generation;
+			}
+
+			InsertedVertex rootVertex = insertVertex( plugToDirty );
+			if( !rootVertex.second )
+			{
+				// Previously inserted, so we'll already
+				// have visited the dependents.
+				return;
+			}
+
+			// Depth-first traversal of the dependents, visiting plugs
+			// in the same order as a DownstreamIterator would.
+			std::vector<Visit> toVisit;
+			toVisit.push_back( Visit( rootVertex.first, dependents( plugToDirty ) ) );
+			while( !toVisit.empty() )
+			{
+				Visit &visit = toVisit.back();
+				if( visit.it == visit.end )
+				{
+					toVisit.pop_back();
+					continue;
+				}
+
+				const Plug *dependent = *visit.it++;
+				const VertexDescriptor upstreamVertex = visit.vertex;
+				if( !dependent->refCount() )
+				{
+					// Plug is being destroyed, and can have no
+					// observers.
+					continue;
+				}
+
+				InsertedVertex v = insertVertex( dependent );
+				if( !dependent->getFlags( Plug::AcceptsDependencyCycles ) )
+				{
+					add_edge( v.first, upstreamVertex, m_graph );
+				}
+
+				// If the plug has been visited already by another
+				// path, then so have its dependents, and we can prune
+				// the traversal.
+				if( v.second )
+				{
+					toVisit.push_back( Visit( v.first, dependents( dependent ) ) );
+				}
+			}
+		}
+
 		// We use this graph structure to keep track of the dirty propagation.
 		// Vertices in the graph represent plugs which have been dirtied, and
 		// edges represent the relationships that caused the dirtying - an
@@ -820,7 +931,7 @@ class Plug::DirtyPlugs
 		typedef Graph::vertex_descriptor VertexDescriptor;
 		typedef Graph::edge_descriptor EdgeDescriptor;
 
-		typedef std::map<const Plug *, VertexDescriptor> PlugMap;
+		typedef boost::unordered_map<const Plug *, VertexDescriptor> PlugMap;
 
 		// Equivalent to the return type for map::insert - the first
 		// field is the vertex descriptor, and the second field is
@@ -828,6 +939,43 @@ class Plug::DirtyPlugs
 		// inserted.
 		typedef std::pair<VertexDescriptor, bool> InsertedVertex;
 
+		typedef std::vector<const Plug *> Dependents;
+		typedef std::unordered_map<const Plug *, Dependents> DependentsCache;
+
+		// Returns the plugs that are directly dependent on `plug`, as
+		// would be visited at the first level of a DownstreamIterator.
+		// The cache is only invalidated at the start of traverse(), so that the
+		// iterators held in Visit remain valid for the duration of the traversal.
+		const Dependents &dependents( const Plug *plug )
+		{
+			std::pair<DependentsCache::iterator, bool> inserted = m_dependents.insert(
+				DependentsCache::value_type( plug, Dependents() )
+			);
+			if( inserted.second )
+			{
+				Dependents &result = inserted.first->second;
+				for( DownstreamIterator it( plug ); !it.done(); ++it )
+				{
+					result.push_back( &*it );
+					it.prune();
+				}
+			}
+
+			return inserted.first->second;
+		}
+
+		struct Visit
+		{
+			Visit( VertexDescriptor vertex, const Dependents &dependents )
+				:	vertex( vertex ), it( dependents.begin() ), end( dependents.end() )
+			{
+			}
+
+			VertexDescriptor vertex;
+			Dependents::const_iterator it;
+			Dependents::const_iterator end;
+		};
+
 		InsertedVertex insertVertex( const Plug *plug )
 		{
 			// We need to hold a reference to the plug, because otherwise
@@ -937,6 +1085,12 @@ class Plug::DirtyPlugs
 		size_t m_scopeCount;
 		bool m_emitting;
 
+		DependentsCache m_dependents;
+		uint64_t m_dependentsGeneration;
+
+		std::vector<PlugPtr> m_pending;
+		boost::unordered_set<const Plug *> m_pendingPlugs;
+
 };
 
 void Plug::propagateDirtiness( Plug *plugToDirty )
@@ -955,6 +1109,11 @@ void Plug::popDirtyPropagationScope()
 	DirtyPlugs::local().popScope();
 }
 
+void Plug::flushDirtyPropagationScope()
+{
+	DirtyPlugs::local().flush();
+}
+
 void Plug::dirty()
 {
 }
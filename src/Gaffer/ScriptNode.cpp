@@ -245,6 +245,7 @@ IE_CORE_DEFINERUNTIMETYPED( ScriptNode );
 size_t ScriptNode::g_firstPlugIndex = 0;
 ScriptNode::SerialiseFunction ScriptNode::g_serialiseFunction;
 ScriptNode::ExecuteFunction ScriptNode::g_executeFunction;
+ScriptNode::FilterFunction ScriptNode::g_filterFunction;
 
 ScriptNode::ScriptNode( const std::string &name )
 	:
@@ -253,6 +254,7 @@ ScriptNode::ScriptNode( const std::string &name )
 	m_undoIterator( m_undoList.end() ),
 	m_currentActionStage( Action::Invalid ),
 	m_executing( false ),
+	m_partiallyLoaded( false ),
 	m_context( new Context )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
@@ -706,15 +708,34 @@ bool ScriptNode::executeFile( const std::string &fileName, Node *parent, bool co
 }
 
 bool ScriptNode::load( bool continueOnError)
+{
+	return loadInternal( nullptr, continueOnError );
+}
+
+bool ScriptNode::load( const std::vector<std::string> &nodeNames, bool continueOnError )
+{
+	return loadInternal( &nodeNames, continueOnError );
+}
+
+bool ScriptNode::loadInternal( const std::vector<std::string> *nodeNames, bool continueOnError )
 {
 	DirtyPropagationScope dirtyScope;
 
 	const std::string fileName = fileNamePlug()->getValue();
-	const std::string s = readFile( fileName );
+	std::string s = readFile( fileName );
+	if( nodeNames )
+	{
+		if( !g_filterFunction )
+		{
+			throw IECore::Exception( "Partial loading not available - please link to libGafferBindings." );
+		}
+		s = g_filterFunction( s, *nodeNames );
+	}
 
 	deleteNodes();
 	variablesPlug()->clearChildren();
 
+	m_partiallyLoaded = nodeNames != nullptr;
 	const bool result = executeInternal( s, nullptr, continueOnError, fileName );
 
 	UndoScope undoDisabled( this, UndoScope::Disabled );
@@ -725,6 +746,10 @@ bool ScriptNode::load( bool continueOnError)
 
 void ScriptNode::save() const
 {
+	if( m_partiallyLoaded )
+	{
+		throw IECore::Exception( "Cannot save partially loaded script \"" + fileNamePlug()->getValue() + "\"" );
+	}
 	serialiseToFile( fileNamePlug()->getValue() );
 	UndoScope undoDisabled( const_cast<ScriptNode *>( this ), UndoScope::Disabled );
 	const_cast<BoolPlug *>( unsavedChangesPlug() )->setValue( false );
@@ -43,12 +43,18 @@
 #include "Gaffer/StringPlug.h"
 #include "Gaffer/SubGraph.h"
 #include "Gaffer/Switch.h"
+#include "Gaffer/ThreadState.h"
 
 #include "IECore/FrameRange.h"
 #include "IECore/MessageHandler.h"
 
 #include "boost/algorithm/string/predicate.hpp"
 #include "boost/filesystem.hpp"
+#include "boost/filesystem/fstream.hpp"
+
+#include "tbb/concurrent_hash_map.h"
+#include "tbb/parallel_do.h"
+#include "tbb/parallel_for.h"
 
 using namespace std;
 using namespace IECore;
@@ -58,13 +64,17 @@ using namespace GafferDispatch;
 static InternedString g_frame( "frame" );
 static InternedString g_batchSize( "batchSize" );
 static InternedString g_immediatePlugName( "immediate" );
+static InternedString g_parallelFramesPlugName( "parallelFrames" );
 static InternedString g_postTaskIndexBlindDataName( "dispatcher:postTaskIndex" );
 static InternedString g_immediateBlindDataName( "dispatcher:immediate" );
+static InternedString g_parallelFramesBlindDataName( "dispatcher:parallelFrames" );
 static InternedString g_sizeBlindDataName( "dispatcher:size" );
 static InternedString g_executedBlindDataName( "dispatcher:executed" );
 static InternedString g_visitedBlindDataName( "dispatcher:visited" );
 static InternedString g_jobDirectoryContextEntry( "dispatcher:jobDirectory" );
 static InternedString g_scriptFileNameContextEntry( "dispatcher:scriptFileName" );
+static InternedString g_taskDatabaseContextEntry( "dispatcher:taskDatabase" );
+static InternedString g_fileNamePlugName( "fileName" );
 static IECore::BoolDataPtr g_trueBoolData = new BoolData( true );
 
 size_t Dispatcher::g_firstPlugIndex = 0;
@@ -84,6 +94,7 @@ Dispatcher::Dispatcher( const std::string &name )
 	addChild( new StringPlug( "frameRange", Plug::In, "1-100x10" ) );
 	addChild( new StringPlug( "jobName", Plug::In, "" ) );
 	addChild( new StringPlug( "jobsDirectory", Plug::In, "" ) );
+	addChild( new BoolPlug( "skipUpToDateTasks", Plug::In, false ) );
 }
 
 Dispatcher::~Dispatcher()
@@ -130,6 +141,16 @@ const StringPlug *Dispatcher::jobsDirectoryPlug() const
 	return getChild<StringPlug>( g_firstPlugIndex + 3 );
 }
 
+BoolPlug *Dispatcher::skipUpToDateTasksPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 4 );
+}
+
+const BoolPlug *Dispatcher::skipUpToDateTasksPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 4 );
+}
+
 const std::string Dispatcher::jobDirectory() const
 {
 	return m_jobDirectory;
@@ -247,6 +268,7 @@ void Dispatcher::setupPlugs( Plug *parentPlug )
 		if( !node->taskPlug()->requiresSequenceExecution() )
 		{
 			parentPlug->addChild( new IntPlug( g_batchSize, Plug::In, 1 ) );
+			parentPlug->addChild( new BoolPlug( g_parallelFramesPlugName, Plug::In, false ) );
 		}
 	}
 
@@ -287,6 +309,107 @@ FrameListPtr Dispatcher::frameRange( const ScriptNode *script, const Context *co
 	}
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Task database implementation
+//
+// The database is simply a directory containing a file per completed
+// task, named according to the task hash. Each file stores the
+// modification time of the task's output file at the point the task
+// completed. Using a file per task means that tasks executing
+// concurrently in separate processes can record themselves without
+// any need for locking.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+boost::filesystem::path taskRecordPath( const std::string &taskDatabase, const TaskNode::TaskPlug *plug, const MurmurHash &taskHash )
+{
+	// Include the plug name so that identical tasks from different
+	// nodes are recorded separately, in the same way that they are
+	// kept separate by the Batcher.
+	MurmurHash h = taskHash;
+	h.append( plug->relativeName( plug->ancestor<ScriptNode>() ) );
+	return boost::filesystem::path( taskDatabase ) / h.toString();
+}
+
+std::string outputFileName( const TaskNode::TaskPlug *plug )
+{
+	const StringPlug *fileNamePlug = plug->node()->getChild<StringPlug>( g_fileNamePlugName );
+	return fileNamePlug ? fileNamePlug->getValue() : "";
+}
+
+} // namespace
+
+void Dispatcher::recordCompletedTask( const TaskNode::TaskPlug *plug )
+{
+	const Context *context = Context::current();
+	const std::string taskDatabase = context->get<string>( g_taskDatabaseContextEntry, "" );
+	if( taskDatabase.empty() )
+	{
+		return;
+	}
+
+	const MurmurHash taskHash = plug->hash();
+	if( taskHash == MurmurHash() )
+	{
+		// No-ops are always considered to be up to date,
+		// so there's nothing to record.
+		return;
+	}
+
+	const boost::filesystem::path recordPath = taskRecordPath( taskDatabase, plug, taskHash );
+	const boost::filesystem::path tmpPath = recordPath.parent_path() / boost::filesystem::unique_path( "%%%%-%%%%-%%%%-%%%%.tmp" );
+
+	boost::system::error_code errorCode;
+	boost::filesystem::create_directories( recordPath.parent_path(), errorCode );
+
+	{
+		boost::filesystem::ofstream record( tmpPath );
+		const std::string fileName = outputFileName( plug );
+		if( fileName.size() && boost::filesystem::exists( fileName ) )
+		{
+			record << boost::filesystem::last_write_time( fileName );
+		}
+		if( !record.good() )
+		{
+			IECore::msg( IECore::Msg::Warning, "Dispatcher", "Unable to record completed task in \"" + tmpPath.string() + "\"" );
+			return;
+		}
+	}
+
+	// Rename into place, so that concurrent readers never
+	// see a partially written record.
+	boost::filesystem::rename( tmpPath, recordPath, errorCode );
+	if( errorCode )
+	{
+		IECore::msg( IECore::Msg::Warning, "Dispatcher", "Unable to record completed task in \"" + recordPath.string() + "\" : " + errorCode.message() );
+		boost::filesystem::remove( tmpPath, errorCode );
+	}
+}
+
+bool Dispatcher::completedTaskIsUpToDate( const TaskNode::TaskPlug *plug, const IECore::MurmurHash &taskHash, const std::string &taskDatabase )
+{
+	boost::filesystem::ifstream record( taskRecordPath( taskDatabase, plug, taskHash ) );
+	if( !record.is_open() )
+	{
+		return false;
+	}
+
+	std::time_t recordedTime;
+	if( record >> recordedTime )
+	{
+		const std::string fileName = outputFileName( plug );
+		if( fileName.empty() || !boost::filesystem::exists( fileName ) )
+		{
+			return false;
+		}
+		return boost::filesystem::last_write_time( fileName ) == recordedTime;
+	}
+
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // TaskBatch implementation
 //////////////////////////////////////////////////////////////////////////
@@ -318,6 +441,36 @@ void Dispatcher::TaskBatch::execute() const
 	}
 
 	Context::Scope scopedContext( m_context.get() );
+
+	if( m_frames.size() > 1 && m_blindData->member<BoolData>( g_parallelFramesBlindDataName ) )
+	{
+		// The node has declared that it is safe to execute several
+		// frames at once, so we execute each in a separate TBB task
+		// with its own context.
+		const ThreadState &threadState = ThreadState::current();
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+		tbb::parallel_for(
+
+			tbb::blocked_range<size_t>( 0, m_frames.size(), 1 ),
+
+			[this, &threadState]( const tbb::blocked_range<size_t> &r ) {
+
+				ThreadState::Scope threadStateScope( threadState );
+				Context::EditableScope frameScope( m_context.get() );
+				for( size_t i = r.begin(); i != r.end(); ++i )
+				{
+					frameScope.setFrame( m_frames[i] );
+					m_plug->execute();
+				}
+
+			},
+
+			taskGroupContext // Prevents outer tasks silently cancelling our tasks
+
+		);
+		return;
+	}
+
 	m_plug->executeSequence( m_frames );
 }
 
@@ -377,16 +530,35 @@ class Dispatcher::Batcher
 
 	public :
 
-		Batcher()
-			:	m_rootBatch( new TaskBatch() )
+		Batcher( const std::string &taskDatabase )
+			:	m_rootBatch( new TaskBatch() ), m_taskDatabase( taskDatabase )
 		{
 		}
 
-		void addTask( const TaskNode::Task &task )
+		void addTasks( const TaskNode::Tasks &tasks )
 		{
-			if( auto batch = batchTasksWalk( task ) )
+			TaskNode::Tasks resolvedTasks;
+			for( const auto &task : tasks )
+			{
+				TaskNode::Task resolvedTask = resolveTask( task );
+				if( resolvedTask.plug()->direction() == Plug::Out )
+				{
+					resolvedTasks.push_back( resolvedTask );
+				}
+			}
+
+			// Evaluating the hashes and preTasks for each task can be
+			// expensive, so we first gather them in parallel for the
+			// whole graph. We then assemble the batches serially, so
+			// that the result is deterministic.
+			gatherTaskInfo( resolvedTasks );
+
+			for( const auto &task : resolvedTasks )
 			{
-				addPreTask( m_rootBatch.get(), batch );
+				if( auto batch = batchTasksWalk( task ) )
+				{
+					addPreTask( m_rootBatch.get(), batch );
+				}
 			}
 		}
 
@@ -397,29 +569,131 @@ class Dispatcher::Batcher
 
 	private :
 
-		TaskBatchPtr batchTasksWalk( TaskNode::Task task, const std::set<const TaskBatch *> &ancestors = std::set<const TaskBatch *>() )
+		// Everything we need to know about a task in order to batch it.
+		// Tasks are assumed to have been passed through `resolveTask()`
+		// already, and `preTasks` and `postTasks` are likewise resolved,
+		// omitting any which don't lead to a TaskNode output.
+		struct TaskInfo
 		{
-			task = TaskNode::Task( task.plug()->source<TaskNode::TaskPlug>(), task.context() );
-			// Deal with Switch and ContextProcessor nodes. We need to do this manually
-			// because they only know how to deal with ValuePlugs, and we use TaskPlugs.
-			if( auto sw = runTimeCast<const Switch>( task.plug()->node() ) )
-			{
-				if( task.plug() == sw->outPlug() )
-				{
-					Context::Scope scopedTaskContext( task.context() );
-					task = TaskNode::Task( sw->activeInPlug()->source<TaskNode::TaskPlug>(), task.context() );
-				}
-			}
-			else if( auto contextProcessor = runTimeCast<const ContextProcessor>( task.plug()->node() ) )
+			// As returned by `TaskPlug::hash()`.
+			IECore::MurmurHash hash;
+			// Unique identity of the task, used to coalesce identical
+			// tasks when batching.
+			IECore::MurmurHash uniqueHash;
+			// As returned by `batchHash()`.
+			IECore::MurmurHash batchHash;
+			TaskNode::Tasks preTasks;
+			TaskNode::Tasks postTasks;
+		};
+
+		typedef tbb::concurrent_hash_map<IECore::MurmurHash, TaskInfo> TaskInfoMap;
+
+		// Key for looking up tasks in `m_taskInfo`.
+		static IECore::MurmurHash taskKey( const TaskNode::Task &task )
+		{
+			IECore::MurmurHash result = task.context()->hash();
+			result.append( (uint64_t)task.plug() );
+			return result;
+		}
+
+		void gatherTaskInfo( const TaskNode::Tasks &tasks )
+		{
+			const ThreadState &threadState = ThreadState::current();
+
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_do(
+
+				tasks.begin(), tasks.end(),
+
+				[this, &threadState]( const TaskNode::Task &task, tbb::parallel_do_feeder<TaskNode::Task> &feeder ) {
+
+					const IECore::MurmurHash key = taskKey( task );
+					{
+						// We don't hold the accessor while computing the info,
+						// because we don't want to block other threads which
+						// might be waiting on it while we do TBB work of our own.
+						TaskInfoMap::accessor accessor;
+						if( !m_taskInfo.insert( accessor, key ) )
+						{
+							// Already visited via another path.
+							return;
+						}
+					}
+
+					ThreadState::Scope threadStateScope( threadState );
+
+					TaskInfo info;
+					TaskNode::Tasks preTasks;
+					TaskNode::Tasks postTasks;
+					{
+						Context::Scope scopedTaskContext( task.context() );
+						info.hash = task.plug()->hash();
+						task.plug()->preTasks( preTasks );
+						task.plug()->postTasks( postTasks );
+					}
+
+					info.uniqueHash = info.hash;
+					if( info.hash == IECore::MurmurHash() )
+					{
+						// Prevent no-ops from coalescing into a single batch, as this
+						// would break parallelism - see `DispatcherTest.testNoOpDoesntBreakFrameParallelism()`
+						info.uniqueHash.append( contextHash( task.context() ) );
+					}
+					// Prevent identical tasks from different nodes from being
+					// coalesced.
+					info.uniqueHash.append( (uint64_t)task.plug() );
+
+					info.batchHash = batchHash( task );
+
+					for( const auto &t : preTasks )
+					{
+						TaskNode::Task resolvedTask = resolveTask( t );
+						if( resolvedTask.plug()->direction() == Plug::Out )
+						{
+							info.preTasks.push_back( resolvedTask );
+							feeder.add( resolvedTask );
+						}
+					}
+
+					for( const auto &t : postTasks )
+					{
+						TaskNode::Task resolvedTask = resolveTask( t );
+						if( resolvedTask.plug()->direction() == Plug::Out )
+						{
+							info.postTasks.push_back( resolvedTask );
+							feeder.add( resolvedTask );
+						}
+					}
+
+					TaskInfoMap::accessor accessor;
+					m_taskInfo.find( accessor, key );
+					accessor->second = info;
+
+				},
+
+				taskGroupContext // Prevents outer tasks silently cancelling our tasks
+
+			);
+		}
+
+		// Must only be called after `gatherTaskInfo()` has completed.
+		const TaskInfo &taskInfo( const TaskNode::Task &task ) const
+		{
+			TaskInfoMap::const_accessor accessor;
+			if( !m_taskInfo.find( accessor, taskKey( task ) ) )
 			{
-				if( task.plug() == contextProcessor->outPlug() )
-				{
-					Context::Scope scopedTaskContext( task.context() );
-					task = TaskNode::Task( contextProcessor->inPlug()->source<TaskNode::TaskPlug>(), contextProcessor->inPlugContext().get() );
-				}
+				throw IECore::Exception( "Task info not found" );
 			}
+			// Safe to return a reference, because there are no
+			// concurrent modifications once gathering is complete.
+			return accessor->second;
+		}
+
+		TaskBatchPtr batchTasksWalk( const TaskNode::Task &task, const std::set<const TaskBatch *> &ancestors = std::set<const TaskBatch *>() )
+		{
+			const TaskInfo &info = taskInfo( task );
 
-			if( task.plug()->direction() != Plug::Out )
+			if( m_taskDatabase.size() && upToDate( task ) )
 			{
 				return nullptr;
 			}
@@ -427,27 +701,18 @@ class Dispatcher::Batcher
 			// Acquire a batch with this task placed in it,
 			// and check that we haven't discovered a cyclic
 			// dependency.
-			TaskBatchPtr batch = acquireBatch( task );
+			TaskBatchPtr batch = acquireBatch( task, info );
 			if( ancestors.find( batch.get() ) != ancestors.end() )
 			{
 				throw IECore::Exception( ( boost::format( "Dispatched tasks cannot have cyclic dependencies but %s is involved in a cycle." ) % batch->plug()->relativeName( batch->plug()->ancestor<ScriptNode>() ) ).str() );
 			}
 
-			// Ask the task what preTasks and postTasks it would like.
-			TaskNode::Tasks preTasks;
-			TaskNode::Tasks postTasks;
-			{
-				Context::Scope scopedTaskContext( task.context() );
-				task.plug()->preTasks( preTasks );
-				task.plug()->postTasks( postTasks );
-			}
-
 			// Collect all the batches the postTasks belong in.
 			// We grab these first because they need to be included
 			// in the ancestors for cycle detection when getting
 			// the preTask batches.
 			TaskBatches postBatches;
-			for( TaskNode::Tasks::const_iterator it = postTasks.begin(); it != postTasks.end(); ++it )
+			for( TaskNode::Tasks::const_iterator it = info.postTasks.begin(); it != info.postTasks.end(); ++it )
 			{
 				if( auto postBatch = batchTasksWalk( *it ) )
 				{
@@ -465,7 +730,7 @@ class Dispatcher::Batcher
 				preTaskAncestors.insert( it->get() );
 			}
 
-			for( TaskNode::Tasks::const_iterator it = preTasks.begin(); it != preTasks.end(); ++it )
+			for( TaskNode::Tasks::const_iterator it = info.preTasks.begin(); it != info.preTasks.end(); ++it )
 			{
 				if( auto preBatch = batchTasksWalk( *it, preTaskAncestors ) )
 				{
@@ -487,27 +752,82 @@ class Dispatcher::Batcher
 			return batch;
 		}
 
-		TaskBatchPtr acquireBatch( const TaskNode::Task &task )
+		// Follows connections to find the task which will actually be
+		// executed. We need to deal with Switch and ContextProcessor nodes
+		// manually because they only know how to deal with ValuePlugs, and
+		// we use TaskPlugs.
+		static TaskNode::Task resolveTask( TaskNode::Task task )
 		{
-			// See if we've previously visited this task, and therefore
-			// have placed it in a batch already, which we can return
-			// unchanged. The `taskHash` is used as the unique identity of
-			// the task.
-			MurmurHash taskHash;
+			task = TaskNode::Task( task.plug()->source<TaskNode::TaskPlug>(), task.context() );
+			if( auto sw = runTimeCast<const Switch>( task.plug()->node() ) )
+			{
+				if( task.plug() == sw->outPlug() )
+				{
+					Context::Scope scopedTaskContext( task.context() );
+					task = TaskNode::Task( sw->activeInPlug()->source<TaskNode::TaskPlug>(), task.context() );
+				}
+			}
+			else if( auto contextProcessor = runTimeCast<const ContextProcessor>( task.plug()->node() ) )
+			{
+				if( task.plug() == contextProcessor->outPlug() )
+				{
+					Context::Scope scopedTaskContext( task.context() );
+					task = TaskNode::Task( contextProcessor->inPlug()->source<TaskNode::TaskPlug>(), contextProcessor->inPlugContext().get() );
+				}
+			}
+			return task;
+		}
+
+		// Returns true if the task was completed by a previous dispatch and
+		// can therefore be omitted from this one. We only omit tasks whose
+		// preTasks and postTasks are also up to date, since otherwise the
+		// task may need to be rerun to pick up changes in their outputs.
+		bool upToDate( const TaskNode::Task &task )
+		{
+			const MurmurHash key = taskKey( task );
+
+			// Insert a provisional result before recursing. This guards
+			// against infinite recursion in the presence of cycles, which
+			// will then be reported by `batchTasksWalk()`.
+			const auto inserted = m_upToDate.insert( UpToDateMap::value_type( key, false ) );
+			if( !inserted.second )
+			{
+				return inserted.first->second;
+			}
+
+			const TaskInfo &info = taskInfo( task );
+
+			bool result = true;
+			if( info.hash != MurmurHash() )
 			{
 				Context::Scope scopedTaskContext( task.context() );
-				taskHash = task.plug()->hash();
+				result = completedTaskIsUpToDate( task.plug(), info.hash, m_taskDatabase );
 			}
-			const bool taskIsNoOp = taskHash == IECore::MurmurHash();
-			if( taskIsNoOp )
+
+			for( const auto &tasks : { &info.preTasks, &info.postTasks } )
 			{
-				// Prevent no-ops from coalescing into a single batch, as this
-				// would break parallelism - see `DispatcherTest.testNoOpDoesntBreakFrameParallelism()`
-				taskHash.append( contextHash( task.context() ) );
+				for( const auto &t : *tasks )
+				{
+					if( !result )
+					{
+						break;
+					}
+					result = upToDate( t );
+				}
 			}
-			// Prevent identical tasks from different nodes from being
-			// coalesced.
-			taskHash.append( (uint64_t)task.plug() );
+
+			m_upToDate[key] = result;
+			return result;
+		}
+
+		TaskBatchPtr acquireBatch( const TaskNode::Task &task, const TaskInfo &info )
+		{
+			// See if we've previously visited this task, and therefore
+			// have placed it in a batch already, which we can return
+			// unchanged. The `uniqueHash` is used as the unique identity of
+			// the task.
+			const MurmurHash &taskHash = info.uniqueHash;
+			const bool taskIsNoOp = info.hash == IECore::MurmurHash();
 
 			const TaskToBatchMap::const_iterator it = m_tasksToBatches.find( taskHash );
 			if( it != m_tasksToBatches.end() )
@@ -523,7 +843,7 @@ class Dispatcher::Batcher
 			const bool requiresSequenceExecution = task.plug()->requiresSequenceExecution();
 
 			TaskBatchPtr batch = nullptr;
-			const MurmurHash batchMapHash = batchHash( task );
+			const MurmurHash &batchMapHash = info.batchHash;
 			BatchMap::iterator bIt = m_currentBatches.find( batchMapHash );
 			if( bIt != m_currentBatches.end() )
 			{
@@ -564,6 +884,12 @@ class Dispatcher::Batcher
 				}
 			}
 
+			const BoolPlug *parallelFramesPlug = dispatcherPlug( task )->getChild<const BoolPlug>( g_parallelFramesPlugName );
+			if( !requiresSequenceExecution && parallelFramesPlug && parallelFramesPlug->getValue() )
+			{
+				batch->blindData()->writable()[g_parallelFramesBlindDataName] = g_trueBoolData;
+			}
+
 			const BoolPlug *immediatePlug = dispatcherPlug( task )->getChild<const BoolPlug>( g_immediatePlugName );
 			if( immediatePlug && immediatePlug->getValue() )
 			{
@@ -584,7 +910,7 @@ class Dispatcher::Batcher
 		// Hash used to determine how to coalesce tasks into batches.
 		// If `batchHash( task1 ) == batchHash( task2 )` then the two
 		// tasks can be placed in the same batch.
-		IECore::MurmurHash batchHash( const TaskNode::Task &task )
+		static IECore::MurmurHash batchHash( const TaskNode::Task &task )
 		{
 			MurmurHash result;
 			result.append( (uint64_t)task.plug() );
@@ -595,7 +921,7 @@ class Dispatcher::Batcher
 			return result;
 		}
 
-		IECore::MurmurHash contextHash( const Context *context, bool ignoreFrame = false ) const
+		static IECore::MurmurHash contextHash( const Context *context, bool ignoreFrame = false )
 		{
 			IECore::MurmurHash result;
 			std::vector<IECore::InternedString> names;
@@ -656,11 +982,17 @@ class Dispatcher::Batcher
 
 		typedef std::map<IECore::MurmurHash, TaskBatchPtr> BatchMap;
 		typedef std::map<IECore::MurmurHash, TaskBatchPtr> TaskToBatchMap;
+		typedef std::map<IECore::MurmurHash, bool> UpToDateMap;
 
 		TaskBatchPtr m_rootBatch;
 		BatchMap m_currentBatches;
 		TaskToBatchMap m_tasksToBatches;
 
+		TaskInfoMap m_taskInfo;
+
+		const std::string m_taskDatabase;
+		UpToDateMap m_upToDate;
+
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -760,6 +1092,17 @@ void Dispatcher::dispatch( const std::vector<NodePtr> &nodes ) const
 	Context::Scope jobScope( jobContext.get() );
 	createJobDirectory( script, jobContext.get() );
 
+	// The task database lives alongside the numbered job directories, so
+	// that it is shared by all dispatches of the same job. We advertise it
+	// via the context so that tasks can record themselves as they complete.
+
+	std::string taskDatabase;
+	if( skipUpToDateTasksPlug()->getValue() )
+	{
+		taskDatabase = ( boost::filesystem::path( m_jobDirectory ).parent_path() / "taskDatabase" ).string();
+		jobContext->set( g_taskDatabaseContextEntry, taskDatabase );
+	}
+
 	// this object calls this->preDispatchSignal() in its constructor and this->postDispatchSignal()
 	// in its destructor, thereby guaranteeing that we always call this->postDispatchSignal().
 
@@ -775,16 +1118,19 @@ void Dispatcher::dispatch( const std::vector<NodePtr> &nodes ) const
 	FrameListPtr frameList = frameRange( script, Context::current() );
 	frameList->asList( frames );
 
-	Batcher batcher;
+	TaskNode::Tasks tasks;
 	for( std::vector<FrameList::Frame>::const_iterator fIt = frames.begin(); fIt != frames.end(); ++fIt )
 	{
 		for( std::vector<TaskNodePtr>::const_iterator nIt = taskNodes.begin(); nIt != taskNodes.end(); ++nIt )
 		{
 			jobContext->setFrame( *fIt );
-			batcher.addTask( TaskNode::Task( *nIt, Context::current() ) );
+			tasks.push_back( TaskNode::Task( *nIt, Context::current() ) );
 		}
 	}
 
+	Batcher batcher( taskDatabase );
+	batcher.addTasks( tasks );
+
 	executeAndPruneImmediateBatches( batcher.rootBatch() );
 
 	// Save the script. If we're in a nested dispatch, this may have been done already by
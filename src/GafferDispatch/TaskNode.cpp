@@ -210,6 +210,7 @@ void TaskNode::TaskPlug::execute() const
 	try
 	{
 		p.taskNode()->execute();
+		Dispatcher::recordCompletedTask( static_cast<const TaskPlug *>( p.plug() ) );
 	}
 	catch( ... )
 	{
@@ -224,6 +225,12 @@ void TaskNode::TaskPlug::executeSequence( const std::vector<float> &frames ) con
 	try
 	{
 		p.taskNode()->executeSequence( frames );
+		Context::EditableScope frameScope( p.context() );
+		for( auto frame : frames )
+		{
+			frameScope.setFrame( frame );
+			Dispatcher::recordCompletedTask( static_cast<const TaskPlug *>( p.plug() ) );
+		}
 	}
 	catch( ... )
 	{
@@ -36,15 +36,20 @@
 
 #include "GafferImage/ImageStats.h"
 
-#include "GafferImage/FormatPlug.h"
+#include "GafferImage/BufferAlgo.h"
 #include "GafferImage/ImageAlgo.h"
-#include "GafferImage/Sampler.h"
 
 #include "Gaffer/BoxPlug.h"
-#include "Gaffer/ScriptNode.h"
-#include "Gaffer/TypedPlug.h"
+#include "Gaffer/Context.h"
+
+#include "IECore/CompoundObject.h"
+#include "IECore/SimpleTypedData.h"
+
+#include <limits>
 
 using namespace std;
+using namespace Imath;
+using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
@@ -57,14 +62,14 @@ namespace
 
 int colorIndex( const ValuePlug *plug )
 {
-	const Color4fPlug *colorPlug = plug->parent<Color4fPlug>();
-	if( !colorPlug )
+	const ValuePlug *parent = plug->parent<ValuePlug>();
+	if( !parent || parent->children().size() != 4 )
 	{
 		return -1;
 	}
 	for( size_t i = 0; i < 4; ++i )
 	{
-		if( plug == colorPlug->getChild( i ) )
+		if( plug == parent->getChild( i ) )
 		{
 			return i;
 		}
@@ -72,6 +77,41 @@ int colorIndex( const ValuePlug *plug )
 	return -1;
 }
 
+int histogramBin( float value, const V2f &range, int numBins )
+{
+	const float f = ( value - range[0] ) / ( range[1] - range[0] );
+	// Written so that NaNs are assigned to the first bin.
+	if( !( f > 0.0f ) )
+	{
+		return 0;
+	}
+	// Clamp before converting to int, because the conversion is
+	// undefined for values out of range. This includes infinite
+	// pixels, and any value when the range has zero width.
+	if( !( f < 1.0f ) )
+	{
+		return numBins - 1;
+	}
+	return std::min( (int)( f * numBins ), numBins - 1 );
+}
+
+// Returns the number of pixels in `area` that lie outside `validArea`.
+// These pixels are outside the data window, so are treated as black.
+int64_t numBlackPixels( const Box2i &area, const Box2i &validArea )
+{
+	int64_t result = (int64_t)area.size().x * area.size().y;
+	if( !BufferAlgo::empty( validArea ) )
+	{
+		result -= (int64_t)validArea.size().x * validArea.size().y;
+	}
+	return result;
+}
+
+const InternedString g_minName( "min" );
+const InternedString g_maxName( "max" );
+const InternedString g_sumName( "sum" );
+const InternedString g_averageName( "average" );
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -100,6 +140,23 @@ ImageStats::ImageStats( const std::string &name )
 	addChild( new Color4fPlug( "average", Gaffer::Plug::Out, Imath::Color4f( 0, 0, 0, 1 ) ) );
 	addChild( new Color4fPlug( "min", Gaffer::Plug::Out, Imath::Color4f( 0, 0, 0, 1 ) ) );
 	addChild( new Color4fPlug( "max", Gaffer::Plug::Out, Imath::Color4f( 0, 0, 0, 1 ) ) );
+
+	addChild( new IntPlug( "histogramBins", Gaffer::Plug::In, 256, 1 ) );
+	addChild( new V2fPlug( "histogramRange", Gaffer::Plug::In, V2f( 0, 1 ) ) );
+	addChild( new FloatPlug( "percentile", Gaffer::Plug::In, 50, 0, 100 ) );
+
+	ValuePlugPtr histogramPlug = new ValuePlug( "histogram", Gaffer::Plug::Out );
+	histogramPlug->addChild( new IntVectorDataPlug( "r", Gaffer::Plug::Out, new IntVectorData ) );
+	histogramPlug->addChild( new IntVectorDataPlug( "g", Gaffer::Plug::Out, new IntVectorData ) );
+	histogramPlug->addChild( new IntVectorDataPlug( "b", Gaffer::Plug::Out, new IntVectorData ) );
+	histogramPlug->addChild( new IntVectorDataPlug( "a", Gaffer::Plug::Out, new IntVectorData ) );
+	addChild( histogramPlug );
+
+	addChild( new Color4fPlug( "percentileValue", Gaffer::Plug::Out, Imath::Color4f( 0, 0, 0, 1 ) ) );
+
+	addChild( new CompoundObjectPlug( "__tileStats", Gaffer::Plug::Out, new CompoundObject ) );
+	addChild( new IntVectorDataPlug( "__tileHistogram", Gaffer::Plug::Out, new IntVectorData ) );
+	addChild( new CompoundObjectPlug( "__allStats", Gaffer::Plug::Out, new CompoundObject ) );
 }
 
 ImageStats::~ImageStats()
@@ -166,13 +223,116 @@ const Color4fPlug *ImageStats::maxPlug() const
 	return getChild<Color4fPlug>( g_firstPlugIndex + 5 );
 }
 
+IntPlug *ImageStats::histogramBinsPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 6 );
+}
+
+const IntPlug *ImageStats::histogramBinsPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 6 );
+}
+
+V2fPlug *ImageStats::histogramRangePlug()
+{
+	return getChild<V2fPlug>( g_firstPlugIndex + 7 );
+}
+
+const V2fPlug *ImageStats::histogramRangePlug() const
+{
+	return getChild<V2fPlug>( g_firstPlugIndex + 7 );
+}
+
+FloatPlug *ImageStats::percentilePlug()
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 8 );
+}
+
+const FloatPlug *ImageStats::percentilePlug() const
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 8 );
+}
+
+ValuePlug *ImageStats::histogramPlug()
+{
+	return getChild<ValuePlug>( g_firstPlugIndex + 9 );
+}
+
+const ValuePlug *ImageStats::histogramPlug() const
+{
+	return getChild<ValuePlug>( g_firstPlugIndex + 9 );
+}
+
+Color4fPlug *ImageStats::percentileValuePlug()
+{
+	return getChild<Color4fPlug>( g_firstPlugIndex + 10 );
+}
+
+const Color4fPlug *ImageStats::percentileValuePlug() const
+{
+	return getChild<Color4fPlug>( g_firstPlugIndex + 10 );
+}
+
+CompoundObjectPlug *ImageStats::tileStatsPlug()
+{
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 11 );
+}
+
+const CompoundObjectPlug *ImageStats::tileStatsPlug() const
+{
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 11 );
+}
+
+IntVectorDataPlug *ImageStats::tileHistogramPlug()
+{
+	return getChild<IntVectorDataPlug>( g_firstPlugIndex + 12 );
+}
+
+const IntVectorDataPlug *ImageStats::tileHistogramPlug() const
+{
+	return getChild<IntVectorDataPlug>( g_firstPlugIndex + 12 );
+}
+
+CompoundObjectPlug *ImageStats::allStatsPlug()
+{
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 13 );
+}
+
+const CompoundObjectPlug *ImageStats::allStatsPlug() const
+{
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 13 );
+}
+
 void ImageStats::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	ComputeNode::affects( input, outputs );
+
+	const bool regionAffected = input == inPlug()->dataWindowPlug() || areaPlug()->isAncestorOf( input );
+	const bool histogramAffected = input == histogramBinsPlug() || histogramRangePlug()->isAncestorOf( input );
+
+	if( input == inPlug()->channelDataPlug() || regionAffected )
+	{
+		outputs.push_back( tileStatsPlug() );
+	}
+
+	if( input == inPlug()->channelDataPlug() || regionAffected || histogramAffected )
+	{
+		outputs.push_back( tileHistogramPlug() );
+	}
+
+	if(
+		input == tileStatsPlug() ||
+		input == inPlug()->channelNamesPlug() ||
+		input == channelsPlug() ||
+		regionAffected
+	)
+	{
+		outputs.push_back( allStatsPlug() );
+	}
+
 	if(
-		input == inPlug()->dataWindowPlug() ||
+		input == allStatsPlug() ||
 		input == inPlug()->channelNamesPlug() ||
-		input == inPlug()->channelDataPlug() ||
 		input == channelsPlug() ||
 		areaPlug()->isAncestorOf( input )
 	)
@@ -183,7 +343,38 @@ void ImageStats::affects( const Gaffer::Plug *input, AffectedPlugsContainer &out
 			outputs.push_back( averagePlug()->getChild(i) );
 			outputs.push_back( maxPlug()->getChild(i) );
 		}
-		return;
+	}
+
+	if(
+		input == tileHistogramPlug() ||
+		input == inPlug()->channelNamesPlug() ||
+		input == channelsPlug() ||
+		regionAffected ||
+		histogramAffected
+	)
+	{
+		for( ValuePlugIterator it( histogramPlug() ); !it.done(); ++it )
+		{
+			outputs.push_back( it->get() );
+		}
+	}
+
+	if( input->parent<ValuePlug>() == histogramPlug() )
+	{
+		outputs.push_back( percentileValuePlug()->getChild( ::colorIndex( static_cast<const ValuePlug *>( input ) ) ) );
+	}
+	else if(
+		input == percentilePlug() ||
+		input == inPlug()->channelNamesPlug() ||
+		input == channelsPlug() ||
+		areaPlug()->isAncestorOf( input ) ||
+		histogramRangePlug()->isAncestorOf( input )
+	)
+	{
+		for( unsigned int i = 0; i < 4; ++i )
+		{
+			outputs.push_back( percentileValuePlug()->getChild( i ) );
+		}
 	}
 }
 
@@ -191,6 +382,58 @@ void ImageStats::hash( const ValuePlug *output, const Context *context, IECore::
 {
 	ComputeNode::hash( output, context, h);
 
+	if( output == tileStatsPlug() || output == tileHistogramPlug() )
+	{
+		// Hash the region relative to the tile origin, so that all tiles
+		// fully inside the area share the same hash if their data is the same.
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const Box2i region = tileRegion( context );
+		inPlug()->channelDataPlug()->hash( h );
+		h.append( region.min - tileOrigin );
+		h.append( region.max - tileOrigin );
+		if( output == tileHistogramPlug() )
+		{
+			ImagePlug::GlobalScope c( context );
+			histogramBinsPlug()->hash( h );
+			histogramRangePlug()->hash( h );
+		}
+		return;
+	}
+	else if( output == allStatsPlug() )
+	{
+		const vector<string> channelNames = validChannelNames();
+		const Box2i area = areaPlug()->getValue();
+		const Box2i validArea = BufferAlgo::intersection( area, inPlug()->dataWindowPlug()->getValue() );
+
+		h.append( area );
+		h.append( validArea );
+		for( const auto &channelName : channelNames )
+		{
+			h.append( channelName );
+		}
+		if( channelNames.empty() || BufferAlgo::empty( validArea ) )
+		{
+			return;
+		}
+
+		ImageAlgo::parallelGatherTiles(
+			inPlug(), channelNames,
+			// Tile
+			[ this ] ( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin )
+			{
+				return tileStatsPlug()->hash();
+			},
+			// Gather
+			[ &h ] ( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin, const IECore::MurmurHash &tileHash )
+			{
+				h.append( tileHash );
+			},
+			validArea,
+			ImageAlgo::BottomToTop
+		);
+		return;
+	}
+
 	const int colorIndex = ::colorIndex( output );
 	if( colorIndex == -1 )
 	{
@@ -198,29 +441,202 @@ void ImageStats::hash( const ValuePlug *output, const Context *context, IECore::
 		return;
 	}
 
+	const ValuePlug *parent = output->parent<ValuePlug>();
+	if( parent != minPlug() && parent != maxPlug() && parent != averagePlug() && parent != histogramPlug() && parent != percentileValuePlug() )
+	{
+		return;
+	}
+
+	// Our outputs don't depend on the tile variables, so we remove them
+	// to get better cache reuse when we're evaluated by image computes.
+	ImagePlug::GlobalScope globalScope( context );
+
 	const std::string channelName = this->channelName( colorIndex );
 	const Imath::Box2i area = areaPlug()->getValue();
 
 	if( channelName.empty() || BufferAlgo::empty( area ) )
 	{
-		h.append( static_cast<const FloatPlug *>( output )->defaultValue() );
+		if( parent != histogramPlug() )
+		{
+			h.append( static_cast<const FloatPlug *>( output )->defaultValue() );
+		}
 		return;
 	}
 
-	Sampler s( inPlug(), channelName, area );
-	s.hash( h );
+	if( parent == histogramPlug() )
+	{
+		const Box2i validArea = BufferAlgo::intersection( area, inPlug()->dataWindowPlug()->getValue() );
+		h.append( area );
+		h.append( validArea );
+		histogramBinsPlug()->hash( h );
+		histogramRangePlug()->hash( h );
+		if( BufferAlgo::empty( validArea ) )
+		{
+			return;
+		}
+
+		ImageAlgo::parallelGatherTiles(
+			inPlug(), vector<string>( { channelName } ),
+			// Tile
+			[ this ] ( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin )
+			{
+				return tileHistogramPlug()->hash();
+			},
+			// Gather
+			[ &h ] ( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin, const IECore::MurmurHash &tileHash )
+			{
+				h.append( tileHash );
+			},
+			validArea,
+			ImageAlgo::BottomToTop
+		);
+	}
+	else if( parent == percentileValuePlug() )
+	{
+		histogramPlug()->getChild<IntVectorDataPlug>( colorIndex )->hash( h );
+		histogramRangePlug()->hash( h );
+		percentilePlug()->hash( h );
+	}
+	else
+	{
+		allStatsPlug()->hash( h );
+		h.append( channelName );
+	}
 }
 
 void ImageStats::compute( ValuePlug *output, const Context *context ) const
 {
+	if( output == tileStatsPlug() )
+	{
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
+		const Box2i region = tileRegion( context );
+
+		ConstFloatVectorDataPtr channelData = inPlug()->channelDataPlug()->getValue();
+		const vector<float> &data = channelData->readable();
+
+		float min = numeric_limits<float>::max();
+		float max = numeric_limits<float>::lowest();
+		double sum = 0.;
+
+		for( int y = region.min.y; y < region.max.y; ++y )
+		{
+			const float *p = &data[BufferAlgo::index( V2i( region.min.x, y ), tileBound )];
+			for( int x = region.min.x; x < region.max.x; ++x, ++p )
+			{
+				const float v = *p;
+				min = std::min( v, min );
+				max = std::max( v, max );
+				sum += v;
+			}
+		}
+
+		CompoundObjectPtr result = new CompoundObject;
+		result->members()[g_minName] = new FloatData( min );
+		result->members()[g_maxName] = new FloatData( max );
+		result->members()[g_sumName] = new DoubleData( sum );
+		static_cast<CompoundObjectPlug *>( output )->setValue( result );
+		return;
+	}
+	else if( output == tileHistogramPlug() )
+	{
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
+		const Box2i region = tileRegion( context );
+
+		int numBins;
+		V2f range;
+		{
+			ImagePlug::GlobalScope c( context );
+			numBins = histogramBinsPlug()->getValue();
+			range = histogramRangePlug()->getValue();
+		}
+
+		ConstFloatVectorDataPtr channelData = inPlug()->channelDataPlug()->getValue();
+		const vector<float> &data = channelData->readable();
+
+		IntVectorDataPtr resultData = new IntVectorData;
+		vector<int> &result = resultData->writable();
+		result.resize( numBins, 0 );
+
+		for( int y = region.min.y; y < region.max.y; ++y )
+		{
+			const float *p = &data[BufferAlgo::index( V2i( region.min.x, y ), tileBound )];
+			for( int x = region.min.x; x < region.max.x; ++x, ++p )
+			{
+				result[histogramBin( *p, range, numBins )]++;
+			}
+		}
+
+		static_cast<IntVectorDataPlug *>( output )->setValue( resultData );
+		return;
+	}
+	else if( output == allStatsPlug() )
+	{
+		const vector<string> channelNames = validChannelNames();
+		const Box2i area = areaPlug()->getValue();
+		const Box2i validArea = BufferAlgo::intersection( area, inPlug()->dataWindowPlug()->getValue() );
+
+		vector<float> mins( channelNames.size(), numeric_limits<float>::max() );
+		vector<float> maxs( channelNames.size(), numeric_limits<float>::lowest() );
+		vector<double> sums( channelNames.size(), 0. );
+
+		if( !channelNames.empty() && !BufferAlgo::empty( validArea ) )
+		{
+			ImageAlgo::parallelGatherTiles(
+				inPlug(), channelNames,
+				// Tile
+				[ this ] ( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin )
+				{
+					return tileStatsPlug()->getValue();
+				},
+				// Gather
+				[ &channelNames, &mins, &maxs, &sums ] ( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin, const ConstCompoundObjectPtr &tileStats )
+				{
+					const size_t i = find( channelNames.begin(), channelNames.end(), channelName ) - channelNames.begin();
+					mins[i] = std::min( mins[i], tileStats->member<FloatData>( g_minName )->readable() );
+					maxs[i] = std::max( maxs[i], tileStats->member<FloatData>( g_maxName )->readable() );
+					sums[i] += tileStats->member<DoubleData>( g_sumName )->readable();
+				},
+				validArea,
+				// Ordered so that the summation is deterministic
+				ImageAlgo::BottomToTop
+			);
+		}
+
+		CompoundObjectPtr result = new CompoundObject;
+		if( !BufferAlgo::empty( area ) )
+		{
+			const bool hasBlackPixels = numBlackPixels( area, validArea ) > 0;
+			const double numPixels = double( area.size().x ) * double( area.size().y );
+			for( size_t i = 0; i < channelNames.size(); ++i )
+			{
+				CompoundObjectPtr channelStats = new CompoundObject;
+				channelStats->members()[g_minName] = new FloatData( hasBlackPixels ? std::min( mins[i], 0.0f ) : mins[i] );
+				channelStats->members()[g_maxName] = new FloatData( hasBlackPixels ? std::max( maxs[i], 0.0f ) : maxs[i] );
+				channelStats->members()[g_averageName] = new FloatData( sums[i] / numPixels );
+				result->members()[channelNames[i]] = channelStats;
+			}
+		}
+
+		static_cast<CompoundObjectPlug *>( output )->setValue( result );
+		return;
+	}
+
 	const int colorIndex = ::colorIndex( output );
-	if( colorIndex == -1 )
+	const ValuePlug *parent = output->parent<ValuePlug>();
+	if(
+		colorIndex == -1 ||
+		( parent != minPlug() && parent != maxPlug() && parent != averagePlug() && parent != histogramPlug() && parent != percentileValuePlug() )
+	)
 	{
 		// Not a plug we know about
 		ComputeNode::compute( output, context );
 		return;
 	}
 
+	ImagePlug::GlobalScope globalScope( context );
+
 	const std::string channelName = this->channelName( colorIndex );
 	const Imath::Box2i area = areaPlug()->getValue();
 
@@ -230,38 +646,96 @@ void ImageStats::compute( ValuePlug *output, const Context *context ) const
 		return;
 	}
 
-	// Loop over the ROI and compute the min, max and average channel values and then set our outputs.
-	Sampler s( inPlug(), channelName, area );
+	if( parent == histogramPlug() )
+	{
+		const Box2i validArea = BufferAlgo::intersection( area, inPlug()->dataWindowPlug()->getValue() );
+		const int numBins = histogramBinsPlug()->getValue();
+		const V2f range = histogramRangePlug()->getValue();
 
-	float min = Imath::limits<float>::max();
-	float max = Imath::limits<float>::min();
-	double sum = 0.;
+		IntVectorDataPtr resultData = new IntVectorData;
+		vector<int> &result = resultData->writable();
+		result.resize( numBins, 0 );
 
-	for( int y = area.min.y; y < area.max.y; ++y )
-	{
-		for( int x = area.min.x; x < area.max.x; ++x )
+		if( !BufferAlgo::empty( validArea ) )
 		{
-			float v = s.sample( x, y );
-			min = std::min( v, min );
-			max = std::max( v, max );
-			sum += v;
+			ImageAlgo::parallelGatherTiles(
+				inPlug(), vector<string>( { channelName } ),
+				// Tile
+				[ this ] ( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin )
+				{
+					return tileHistogramPlug()->getValue();
+				},
+				// Gather
+				[ &result ] ( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin, const ConstIntVectorDataPtr &tileHistogram )
+				{
+					const vector<int> &tileBins = tileHistogram->readable();
+					for( size_t i = 0, e = result.size(); i < e; ++i )
+					{
+						result[i] += tileBins[i];
+					}
+				},
+				validArea
+			);
 		}
+
+		result[histogramBin( 0.0f, range, numBins )] += numBlackPixels( area, validArea );
+		static_cast<IntVectorDataPlug *>( output )->setValue( resultData );
 	}
+	else if( parent == percentileValuePlug() )
+	{
+		ConstIntVectorDataPtr histogramData = histogramPlug()->getChild<IntVectorDataPlug>( colorIndex )->getValue();
+		const vector<int> &histogram = histogramData->readable();
+		const V2f range = histogramRangePlug()->getValue();
+		const float binWidth = ( range[1] - range[0] ) / histogram.size();
 
-	if( output->parent<Plug>() == minPlug() )
+		int64_t numPixels = 0;
+		for( auto n : histogram )
+		{
+			numPixels += n;
+		}
+
+		// Find the bin containing the percentile, and then interpolate
+		// linearly within it.
+		const double target = numPixels * percentilePlug()->getValue() / 100.0;
+		float value = range[0];
+		double cumulative = 0;
+		for( size_t i = 0; i < histogram.size(); ++i )
+		{
+			if( histogram[i] && cumulative + histogram[i] >= target )
+			{
+				value = range[0] + ( i + ( target - cumulative ) / histogram[i] ) * binWidth;
+				break;
+			}
+			cumulative += histogram[i];
+		}
+
+		static_cast<FloatPlug *>( output )->setValue( value );
+	}
+	else
 	{
-		static_cast<FloatPlug *>( output )->setValue( min );
+		ConstCompoundObjectPtr allStats = allStatsPlug()->getValue();
+		const CompoundObject *channelStats = allStats->member<CompoundObject>( channelName );
+		const InternedString &statName = parent == minPlug() ? g_minName : ( parent == maxPlug() ? g_maxName : g_averageName );
+		static_cast<FloatPlug *>( output )->setValue( channelStats->member<FloatData>( statName )->readable() );
 	}
-	else if( output->parent<Plug>() == maxPlug() )
+}
+
+Gaffer::ValuePlug::CachePolicy ImageStats::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == allStatsPlug() || output->parent() == histogramPlug() )
 	{
-		static_cast<FloatPlug *>( output )->setValue( max );
+		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
-	else if( output->parent<Plug>() == averagePlug() )
+	return ComputeNode::computeCachePolicy( output );
+}
+
+Gaffer::ValuePlug::CachePolicy ImageStats::hashCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == allStatsPlug() || output->parent() == histogramPlug() )
 	{
-		static_cast<FloatPlug *>( output )->setValue(
-			sum / double( (area.size().x) * (area.size().y) )
-		);
+		return ValuePlug::CachePolicy::TaskCollaboration;
 	}
+	return ComputeNode::hashCachePolicy( output );
 }
 
 std::string ImageStats::channelName( int colorIndex ) const
@@ -282,3 +756,27 @@ std::string ImageStats::channelName( int colorIndex ) const
 
 	return "";
 }
+
+Imath::Box2i ImageStats::tileRegion( const Gaffer::Context *context ) const
+{
+	const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+	const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
+
+	ImagePlug::GlobalScope c( context );
+	const Box2i validArea = BufferAlgo::intersection( areaPlug()->getValue(), inPlug()->dataWindowPlug()->getValue() );
+	return BufferAlgo::intersection( tileBound, validArea );
+}
+
+std::vector<std::string> ImageStats::validChannelNames() const
+{
+	vector<string> result;
+	for( int i = 0; i < 4; ++i )
+	{
+		const string channelName = this->channelName( i );
+		if( !channelName.empty() && find( result.begin(), result.end(), channelName ) == result.end() )
+		{
+			result.push_back( channelName );
+		}
+	}
+	return result;
+}
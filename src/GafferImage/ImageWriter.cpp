@@ -59,6 +59,7 @@
 
 #include "tbb/spin_mutex.h"
 
+#include <future>
 #include <memory>
 
 #include <sys/utsname.h>
@@ -374,6 +375,10 @@ class FlatTileWriter
 		ConstFloatVectorDataPtr m_blackTile;
 };
 
+// The maximum size in bytes of each of the buffers used by FlatScanlineWriter.
+// Batches always contain at least one row of tiles, regardless of this limit.
+const size_t g_maxScanlineBatchSize = 32 * 1024 * 1024;
+
 class FlatScanlineWriter
 {
 	// This class is created to be used by parallelGatherTiles, and called in
@@ -383,11 +388,16 @@ class FlatScanlineWriter
 	// scanlines that fall between the start of the image and the start of the
 	// data that it is going to be given.
 	//
-	// It stores a vector of floats big enough to hold ImagePlug::tileSize()
-	// scanlines. As it receives each tile, it copies the data into the
-	// appropriate location in the buffer. When it's copied the last channel
-	// of the last tile of each row, it writes all of the data from the buffer
-	// into the ImageOutput object.
+	// It stores two buffers, each big enough to hold a batch of several rows
+	// of tiles. As it receives each tile, it copies the data into the
+	// appropriate location in the current buffer. When a buffer is full, all of
+	// its scanlines are written to the ImageOutput with a single call, from a
+	// separate thread. Meanwhile, the next batch of tiles is gathered into the
+	// other buffer. Writing many scanlines at once allows OpenEXR to compress
+	// the chunks in parallel using its own thread pool, and writing
+	// asynchronously allows the computation of the next tiles to overlap
+	// with compression and I/O. Memory usage is bounded by the size of
+	// the two buffers.
 	public:
 		FlatScanlineWriter(
 				ImageOutputPtr out,
@@ -400,9 +410,20 @@ class FlatScanlineWriter
 				m_format( format ),
 				m_spec( m_out->spec() ),
 				m_processWindow( processWindow ),
-				m_tilesBounds( Imath::Box2i( ImagePlug::tileOrigin( processWindow.min ), ImagePlug::tileOrigin( processWindow.max - Imath::V2i( 1 ) ) + Imath::V2i( ImagePlug::tileSize() ) ) )
+				m_tilesBounds( Imath::Box2i( ImagePlug::tileOrigin( processWindow.min ), ImagePlug::tileOrigin( processWindow.max - Imath::V2i( 1 ) ) + Imath::V2i( ImagePlug::tileSize() ) ) ),
+				m_rowSize( m_spec.width * ImagePlug::tileSize() * m_spec.channelnames.size() ),
+				m_rowsPerBatch( std::min<size_t>( numTileRows(), std::max<size_t>( 1, g_maxScanlineBatchSize / std::max<size_t>( 1, m_rowSize * sizeof( float ) ) ) ) ),
+				m_currentBuffer( 0 ),
+				m_numBatchRows( 0 ),
+				m_batchBegin( 0 )
 		{
-			m_scanlinesData.resize( m_spec.width * ImagePlug::tileSize() * m_spec.channelnames.size(), 0.0 );
+			m_scanlinesData[0].resize( m_rowSize * m_rowsPerBatch, 0.0 );
+			if( numTileRows() > m_rowsPerBatch )
+			{
+				// The second buffer is only needed if there
+				// is more than one batch.
+				m_scanlinesData[1].resize( m_rowSize * m_rowsPerBatch, 0.0 );
+			}
 
 			writeInitialBlankScanlines();
 		}
@@ -415,6 +436,8 @@ class FlatScanlineWriter
 				return;
 			}
 
+			waitForPendingWrite();
+
 			const int scanlinesEnd = m_format.toEXRSpace( m_tilesBounds.min.y - 1 );
 			if( scanlinesEnd < ( m_spec.y + m_spec.height ) )
 			{
@@ -432,27 +455,43 @@ class FlatScanlineWriter
 			const Imath::Box2i exrScanlinesBounds( Imath::V2i( m_spec.x, exrInTileBounds.min.y ), Imath::V2i( m_spec.x + m_spec.width - 1, exrInTileBounds.max.y ) );
 			const Imath::Box2i scanlinesBounds( m_format.fromEXRSpace( exrScanlinesBounds ) );
 
+			float *rowData = &m_scanlinesData[m_currentBuffer][0] + m_numBatchRows * m_rowSize;
 			if( firstTileOfRow( channelIndex, tileOrigin ) )
 			{
-				std::fill( m_scanlinesData.begin(), m_scanlinesData.end(), 0.0 );
+				if( m_numBatchRows == 0 )
+				{
+					m_batchBegin = exrInTileBounds.min.y;
+				}
+				std::fill( rowData, rowData + m_rowSize, 0.0 );
 			}
 
 			Imath::Box2i copyArea( BufferAlgo::intersection( m_processWindow, BufferAlgo::intersection( inTileBounds, scanlinesBounds ) ) );
 
-			copyBufferArea( &data->readable()[0], inTileBounds, &m_scanlinesData[0], scanlinesBounds, channelIndex, m_spec.channelnames.size(), true, copyArea );
+			copyBufferArea( &data->readable()[0], inTileBounds, rowData, scanlinesBounds, channelIndex, m_spec.channelnames.size(), true, copyArea );
 
 			if( lastTileOfRow( channelIndex, tileOrigin ) )
 			{
-				writeScanlines(
-					std::max( exrInTileBounds.min.y, m_spec.y ),
-					std::min( exrInTileBounds.max.y + 1, m_spec.y + m_spec.height ),
-					std::max( m_spec.y - exrInTileBounds.min.y, 0 )
-				);
+				m_numBatchRows++;
+				if( m_numBatchRows == m_rowsPerBatch || tileOrigin.y == m_tilesBounds.min.y )
+				{
+					writeBatch();
+				}
 			}
 		}
 
 	private:
 
+		// Returns the number of rows of tiles to be written,
+		// or 1 if there are none.
+		size_t numTileRows() const
+		{
+			if( BufferAlgo::empty( m_processWindow ) )
+			{
+				return 1;
+			}
+			return std::max( 1, m_tilesBounds.size().y / ImagePlug::tileSize() );
+		}
+
 		inline bool firstTileOfRow( const size_t channelIndex, const Imath::V2i &tileOrigin ) const
 		{
 			return channelIndex == 0 && tileOrigin.x == m_tilesBounds.min.x;
@@ -463,9 +502,39 @@ class FlatScanlineWriter
 			return channelIndex == ( m_spec.channelnames.size() - 1 ) && tileOrigin.x == ( m_tilesBounds.max.x - ImagePlug::tileSize() ) ;
 		}
 
-		void writeScanlines( const int exrYBegin, const int exrYEnd, const int scanlinesYOffset = 0 ) const
+		void writeBatch()
+		{
+			const int batchEnd = m_batchBegin + m_numBatchRows * ImagePlug::tileSize();
+			const int exrYBegin = std::max( m_batchBegin, m_spec.y );
+			const int exrYEnd = std::min( batchEnd, m_spec.y + m_spec.height );
+			const float *data = &m_scanlinesData[m_currentBuffer][0] + ( exrYBegin - m_batchBegin ) * m_spec.width * m_spec.channelnames.size();
+
+			// Only one write may be in flight at a time, and it must
+			// complete before we start filling its buffer again.
+			waitForPendingWrite();
+			m_pendingWrite = std::async(
+				std::launch::async,
+				[this, exrYBegin, exrYEnd, data] {
+					writeScanlines( exrYBegin, exrYEnd, data );
+				}
+			);
+
+			m_currentBuffer = 1 - m_currentBuffer;
+			m_numBatchRows = 0;
+		}
+
+		void waitForPendingWrite()
 		{
-			if ( !m_out->write_scanlines( exrYBegin, exrYEnd, 0, TypeDesc::FLOAT, &m_scanlinesData[0] + ( scanlinesYOffset * m_spec.width * m_spec.channelnames.size() ) ) )
+			if( m_pendingWrite.valid() )
+			{
+				// Rethrows any exception from `writeScanlines()`.
+				m_pendingWrite.get();
+			}
+		}
+
+		void writeScanlines( const int exrYBegin, const int exrYEnd, const float *data ) const
+		{
+			if ( !m_out->write_scanlines( exrYBegin, exrYEnd, 0, TypeDesc::FLOAT, data ) )
 			{
 				throw IECore::Exception( boost::str( boost::format( "Could not write scanline to \"%s\", error = %s" ) % m_fileName % m_out->geterror() ) );
 			}
@@ -473,12 +542,16 @@ class FlatScanlineWriter
 
 		void writeBlankScanlines( int yBegin, int yEnd )
 		{
-			float *scanlines = &m_scanlinesData[0];
-			memset( scanlines, 0, sizeof(float) * m_spec.width * std::min( ImagePlug::tileSize(), yEnd - yBegin ) * m_spec.channelnames.size() );
+			// Blank scanlines are only written when no batch write is in
+			// flight, so we can always use the first buffer, which is the
+			// only one guaranteed to have been allocated.
+			const int maxLines = m_rowsPerBatch * ImagePlug::tileSize();
+			float *scanlines = &m_scanlinesData[0][0];
+			memset( scanlines, 0, sizeof(float) * m_spec.width * std::min( maxLines, yEnd - yBegin ) * m_spec.channelnames.size() );
 			while( yBegin < yEnd )
 			{
-				const int numLines = std::min( yEnd - yBegin, ImagePlug::tileSize() );
-				writeScanlines( yBegin, yBegin + numLines );
+				const int numLines = std::min( yEnd - yBegin, maxLines );
+				writeScanlines( yBegin, yBegin + numLines, scanlines );
 				yBegin += numLines;
 			}
 		}
@@ -506,7 +579,15 @@ class FlatScanlineWriter
 		const ImageSpec m_spec;
 		const Imath::Box2i &m_processWindow;
 		const Imath::Box2i m_tilesBounds;
-		vector<float> m_scanlinesData;
+		const size_t m_rowSize;
+		const size_t m_rowsPerBatch;
+		vector<float> m_scanlinesData[2];
+		int m_currentBuffer;
+		size_t m_numBatchRows;
+		int m_batchBegin;
+		// Declared last so that it is destroyed first, waiting for
+		// any pending write to complete before the buffers are freed.
+		std::future<void> m_pendingWrite;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -722,6 +803,7 @@ ImageWriter::ImageWriter( const std::string &name )
 	addChild( new StringPlug( "fileName" ) );
 	addChild( new StringPlug( "channels", Gaffer::Plug::In, "*" ) );
 	addChild( new StringPlug( "colorSpace" ) );
+	addChild( new BoolPlug( "cropToFormat" ) );
 	addChild( new ImagePlug( "out", Plug::Out, Plug::Default & ~Plug::Serialisable ) );
 	outPlug()->setInput( inPlug() );
 
@@ -843,24 +925,34 @@ const Gaffer::StringPlug *ImageWriter::colorSpacePlug() const
 	return getChild<StringPlug>( g_firstPlugIndex+3 );
 }
 
+Gaffer::BoolPlug *ImageWriter::cropToFormatPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex+4 );
+}
+
+const Gaffer::BoolPlug *ImageWriter::cropToFormatPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex+4 );
+}
+
 GafferImage::ImagePlug *ImageWriter::outPlug()
 {
-	return getChild<ImagePlug>( g_firstPlugIndex+4 );
+	return getChild<ImagePlug>( g_firstPlugIndex+5 );
 }
 
 const GafferImage::ImagePlug *ImageWriter::outPlug() const
 {
-	return getChild<ImagePlug>( g_firstPlugIndex+4 );
+	return getChild<ImagePlug>( g_firstPlugIndex+5 );
 }
 
 GafferImage::ColorSpace *ImageWriter::colorSpaceNode()
 {
-	return getChild<ColorSpace>( g_firstPlugIndex+5 );
+	return getChild<ColorSpace>( g_firstPlugIndex+6 );
 }
 
 const GafferImage::ColorSpace *ImageWriter::colorSpaceNode() const
 {
-	return getChild<ColorSpace>( g_firstPlugIndex+5 );
+	return getChild<ColorSpace>( g_firstPlugIndex+6 );
 }
 
 Gaffer::ValuePlug *ImageWriter::fileFormatSettingsPlug( const std::string &fileFormat )
@@ -951,6 +1043,7 @@ IECore::MurmurHash ImageWriter::hash( const Context *context ) const
 	h.append( fileNamePlug()->hash() );
 	h.append( channelsPlug()->hash() );
 	h.append( colorSpacePlug()->hash() );
+	h.append( cropToFormatPlug()->hash() );
 	const std::string fileFormat = currentFileFormat();
 
 	if( fileFormat != "" )
@@ -991,7 +1084,14 @@ void ImageWriter::execute() const
 	// Create an OIIO::ImageSpec describing what we'll write
 
 	const Format imageFormat = inPlug()->formatPlug()->getValue();
-	const Imath::Box2i dataWindow = inPlug()->dataWindowPlug()->getValue();
+	Imath::Box2i dataWindow = inPlug()->dataWindowPlug()->getValue();
+	if( cropToFormatPlug()->getValue() )
+	{
+		// Restricting the data window here means that tiles outside
+		// the display window are never computed.
+		dataWindow = BufferAlgo::intersection( dataWindow, imageFormat.getDisplayWindow() );
+	}
+
 	Imath::Box2i exrDataWindow;
 
 	if( !BufferAlgo::empty( dataWindow ) )
@@ -1077,16 +1177,27 @@ void ImageWriter::execute() const
 
 	TileProcessor processor = TileProcessor();
 
+	// Note that `parallelGatherTiles()` would process the entire data
+	// window if given an empty window, so we must guard against that
+	// case ourselves. The writers fill any unwritten pixels with black.
+	const bool processTiles = !BufferAlgo::empty( processDataWindow );
+
 	if ( spec.tile_width == 0 )
 	{
 		FlatScanlineWriter flatScanlineWriter( out, fileName, processDataWindow, imageFormat );
-		ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), spec.channelnames, processor, flatScanlineWriter, processDataWindow, ImageAlgo::TopToBottom );
+		if( processTiles )
+		{
+			ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), spec.channelnames, processor, flatScanlineWriter, processDataWindow, ImageAlgo::TopToBottom );
+		}
 		flatScanlineWriter.finish();
 	}
 	else
 	{
 		FlatTileWriter flatTileWriter( out, fileName, processDataWindow, imageFormat );
-		ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), spec.channelnames, processor, flatTileWriter, processDataWindow, ImageAlgo::TopToBottom );
+		if( processTiles )
+		{
+			ImageAlgo::parallelGatherTiles( colorSpaceNode()->outPlug(), spec.channelnames, processor, flatTileWriter, processDataWindow, ImageAlgo::TopToBottom );
+		}
 		flatTileWriter.finish();
 	}
 
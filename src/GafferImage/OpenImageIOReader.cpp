@@ -59,7 +59,15 @@
 
 #include "tbb/mutex.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
 
 OIIO_NAMESPACE_USING
 
@@ -117,6 +125,173 @@ V2i coordinateDivide( V2i a, V2i b )
 	return V2i( coordinateDivide( a.x, b.x ), coordinateDivide( a.y, b.y ) );
 }
 
+// Counters used to implement `OpenImageIOReader::readAheadStatistics()`.
+std::atomic<size_t> g_readAheadReads( 0 );
+std::atomic<size_t> g_readAheadBatchesRead( 0 );
+std::atomic<size_t> g_readAheadBatchesUsed( 0 );
+
+// A small pool of dedicated threads used to read tile batches ahead of
+// time. Reading is typically I/O bound, so we use our own threads rather
+// than occupying TBB worker threads that could be doing computation.
+class ReadAheadPool
+{
+
+	public :
+
+		static ReadAheadPool &instance()
+		{
+			// Constructed on first use, which is always after OpenImageIO
+			// has been initialised, so we are destroyed (and join our
+			// threads) before OpenImageIO is torn down at exit.
+			static ReadAheadPool g_pool;
+			return g_pool;
+		}
+
+		~ReadAheadPool()
+		{
+			// Pending reads are discarded. Anyone waiting on them
+			// receives a `broken_promise` exception and reads the
+			// batch itself.
+			std::deque<std::function<void ()>> queue;
+			{
+				std::lock_guard<std::mutex> lock( m_mutex );
+				m_stopping = true;
+				queue.swap( m_queue );
+			}
+			m_condition.notify_all();
+			for( auto &t : m_threads )
+			{
+				t.join();
+			}
+		}
+
+		void setNumThreads( size_t numThreads )
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			m_targetNumThreads = numThreads;
+			// Surplus threads go idle when they are woken.
+			m_condition.notify_all();
+		}
+
+		size_t getNumThreads() const
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			return m_targetNumThreads;
+		}
+
+		// Returns false if there are no threads to run the function.
+		bool enqueue( std::function<void ()> &&f )
+		{
+			std::lock_guard<std::mutex> lock( m_mutex );
+			if( !m_targetNumThreads || m_stopping )
+			{
+				return false;
+			}
+
+			m_queue.push_back( std::move( f ) );
+			// Threads are launched lazily, so that no resources
+			// are used unless read-ahead is actually requested.
+			if( m_threads.size() < m_targetNumThreads )
+			{
+				m_threads.emplace_back( &ReadAheadPool::worker, this, m_threads.size() );
+			}
+			m_condition.notify_all();
+			return true;
+		}
+
+	private :
+
+		ReadAheadPool()
+			:	m_targetNumThreads( 4 ), m_stopping( false )
+		{
+		}
+
+		void worker( size_t index )
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			while( true )
+			{
+				// Threads beyond the target number stay idle, except
+				// for the first thread, which always drains the queue
+				// because readers may be waiting on the results.
+				m_condition.wait(
+					lock,
+					[this, index] {
+						return m_stopping || ( m_queue.size() && ( index < m_targetNumThreads || index == 0 ) );
+					}
+				);
+
+				if( m_stopping )
+				{
+					return;
+				}
+
+				std::function<void ()> f = std::move( m_queue.front() );
+				m_queue.pop_front();
+
+				lock.unlock();
+				f();
+				lock.lock();
+			}
+		}
+
+		mutable std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::deque<std::function<void ()>> m_queue;
+		std::vector<std::thread> m_threads;
+		size_t m_targetNumThreads;
+		bool m_stopping;
+
+};
+
+// Upper limit on the number of tile batches held in read-ahead
+// storage for a single file.
+const size_t g_maxReadAheadBatches = 32;
+
+// Limit on the memory held in read-ahead storage across all files,
+// and the amount currently reserved. Read-ahead storage isn't part of
+// Gaffer's cache, so this stops batches which are never requested from
+// accumulating across the many files that may be open at once. Memory
+// is reserved when a read is scheduled, and released when the batch is
+// taken or discarded, or the file is closed.
+std::atomic<size_t> g_readAheadMemoryLimit( 512 * 1024 * 1024 );
+std::atomic<size_t> g_readAheadMemoryUsage( 0 );
+
+bool reserveReadAheadMemory( size_t bytes )
+{
+	size_t usage = g_readAheadMemoryUsage;
+	do
+	{
+		if( usage + bytes > g_readAheadMemoryLimit )
+		{
+			return false;
+		}
+	} while( !g_readAheadMemoryUsage.compare_exchange_weak( usage, usage + bytes ) );
+
+	return true;
+}
+
+void releaseReadAheadMemory( size_t bytes )
+{
+	g_readAheadMemoryUsage -= bytes;
+}
+
+struct TileBatchIndexLess
+{
+	bool operator()( const V3i &a, const V3i &b ) const
+	{
+		if( a.z != b.z )
+		{
+			return a.z < b.z;
+		}
+		if( a.y != b.y )
+		{
+			return a.y < b.y;
+		}
+		return a.x < b.x;
+	}
+};
+
 // This class handles storing a file handle, and reading data from it in a way compatible with how we want
 // to store it on plugs.
 //
@@ -145,8 +320,13 @@ V2i coordinateDivide( V2i a, V2i b )
 // of the image horizontally ( this means that the left of the tileBatch is aligned to the data window, not
 // the origin ).
 //
+// Tile batches may also be "read ahead" asynchronously. When a batch is requested, the following batches in
+// file order ( downwards for scanline images, and rightwards along the row for tiled images ) are read in the
+// background by a single coalesced `read_scanlines()` or `read_tiles()` call, and held until they are
+// requested. Requests for batches which are already being read ahead wait for that read rather than issuing
+// another.
 //
-class File
+class File : public std::enable_shared_from_this<File>
 {
 
 	public:
@@ -204,6 +384,8 @@ class File
 						channelNames.push_back( channelName );
 					}
 				}
+				m_subImageChannelCounts.resize( subImageIndex + 1, 0 );
+				m_subImageChannelCounts[subImageIndex] = currentSpec.nchannels;
 				subImageIndex++;
 			} while( m_imageInput->seek_subimage( subImageIndex, 0, currentSpec ) );
 
@@ -232,29 +414,158 @@ class File
 				const int batchTileCount = ( batchTargetSize + ImagePlug::tileSize() - 1 ) / ImagePlug::tileSize();
 				m_tileBatchSize = Imath::V2i( batchTileCount );
 			}
+
+			// Find the range of tile batches that cover the data window,
+			// so that we don't read ahead beyond it.
+			const Box2i dataWindow = flopDisplayWindow(
+				Box2i( V2i( m_imageSpec.x, m_imageSpec.y ), V2i( m_imageSpec.x + m_imageSpec.width, m_imageSpec.y + m_imageSpec.height ) ),
+				m_imageSpec.full_y, m_imageSpec.full_height
+			);
+			if( !BufferAlgo::empty( dataWindow ) )
+			{
+				const V3i minIndex = tileBatchIndex( 0, ImagePlug::tileOrigin( dataWindow.min ) );
+				const V3i maxIndex = tileBatchIndex( 0, ImagePlug::tileOrigin( dataWindow.max - V2i( 1 ) ) );
+				m_tileBatchRange = Box2i( V2i( minIndex.x, minIndex.y ), V2i( maxIndex.x, maxIndex.y ) );
+			}
 		}
 
-		// Read a chunk of data from the file, formatted as a tile batch that will be stored on the tile batch plug
-		ConstObjectVectorPtr readTileBatch( V3i tileBatchIndex )
+		~File()
 		{
-			V2i batchFirstTile = V2i( tileBatchIndex.x, tileBatchIndex.y ) * m_tileBatchSize;
-			Box2i targetRegion = Box2i( batchFirstTile * ImagePlug::tileSize(),
-				( batchFirstTile + m_tileBatchSize ) * ImagePlug::tileSize()
-			);
+			// Release the memory held by batches that were
+			// read ahead but never requested.
+			for( const auto &b : m_readAheadBatches )
+			{
+				releaseReadAheadMemory( b.second.bytes );
+			}
+		}
+
+		// Read a chunk of data from the file, formatted as a tile batch that will be stored on the tile batch plug.
+		// If `readAhead` is non-zero, up to that many of the following batches are read asynchronously.
+		ConstObjectVectorPtr readTileBatch( V3i tileBatchIndex, int readAhead )
+		{
+			ConstObjectVectorPtr result;
+			std::shared_future<ConstObjectVectorPtr> readAheadResult = takeReadAheadTileBatch( tileBatchIndex );
+			if( readAheadResult.valid() )
+			{
+				try
+				{
+					result = readAheadResult.get();
+					g_readAheadBatchesUsed++;
+				}
+				catch( ... )
+				{
+					// Fall through to a regular read, so that any
+					// errors are reported in the usual way.
+				}
+			}
+
+			if( !result )
+			{
+				result = readTileBatches( tileBatchIndex, 1 ).front();
+			}
+
+			if( readAhead > 0 )
+			{
+				scheduleReadAhead( tileBatchIndex, readAhead );
+			}
+
+			return result;
+		}
+
+		// Given a channelName and tileOrigin, return the information necessary to look up the data for this tile.
+		// The tileBatchIndex is used to find a tileBatch, and then the tileBatchSubIndex tells you the index
+		// within that tile to use
+		void findTile( const std::string &channelName, const Imath::V2i &tileOrigin, V3i &batchIndex, int &batchSubIndex ) const
+		{
+			ChannelMapEntry channelMapEntry = m_channelMap.at( channelName );
+			batchIndex = tileBatchIndex( channelMapEntry.subImage, tileOrigin );
+			batchSubIndex = tileBatchSubIndex( channelMapEntry.channelIndex, tileOrigin );
+		}
+
+		const ImageSpec &imageSpec() const
+		{
+			return m_imageSpec;
+		}
+
+		std::string formatName() const
+		{
+			return m_imageInput->format_name();
+		}
+
+		ConstStringVectorDataPtr channelNamesData()
+		{
+			return m_channelNamesData;
+		}
+
+	private:
+
+		// Returns the region of the image covered by a tile batch.
+		Box2i tileBatchRegion( const V3i &tileBatchIndex ) const
+		{
+			const V2i batchFirstTile = V2i( tileBatchIndex.x, tileBatchIndex.y ) * m_tileBatchSize;
+			Box2i result( batchFirstTile * ImagePlug::tileSize(), ( batchFirstTile + m_tileBatchSize ) * ImagePlug::tileSize() );
 
 			if( !m_tiled )
 			{
 				// For scanline images, we always treat the tile batch as starting from the left of the data window
-				batchFirstTile.x = ImagePlug::tileIndex( V2i( m_imageSpec.x, 0 ) ).x;
+				result.min.x = m_imageSpec.x;
+				result.max.x = m_imageSpec.x + m_imageSpec.width;
+			}
+
+			return result;
+		}
 
-				targetRegion.min.x = m_imageSpec.x;
-				targetRegion.max.x = m_imageSpec.x + m_imageSpec.width;
+		// Returns the index of the tile batch following `tileBatchIndex` in file order.
+		V3i nextTileBatchIndex( const V3i &tileBatchIndex ) const
+		{
+			if( m_tiled )
+			{
+				return tileBatchIndex + V3i( 1, 0, 0 );
+			}
+			else
+			{
+				return tileBatchIndex - V3i( 0, 1, 0 );
+			}
+		}
+
+		bool validTileBatchIndex( const V3i &tileBatchIndex ) const
+		{
+			return BufferAlgo::contains( Box2i( m_tileBatchRange.min, m_tileBatchRange.max + V2i( 1 ) ), V2i( tileBatchIndex.x, tileBatchIndex.y ) );
+		}
+
+		// Reads `count` consecutive tile batches in file order, starting at
+		// `firstTileBatchIndex`, using a single read from the file.
+		std::vector<ConstObjectVectorPtr> readTileBatches( const V3i &firstTileBatchIndex, int count )
+		{
+			std::vector<V3i> indices = { firstTileBatchIndex };
+			Box2i targetRegion = tileBatchRegion( firstTileBatchIndex );
+			for( int i = 1; i < count; ++i )
+			{
+				indices.push_back( nextTileBatchIndex( indices.back() ) );
+				targetRegion.extendBy( tileBatchRegion( indices.back() ) );
 			}
 
 			// Do the actual read of data
 			std::vector<float> fileData;
 			Box2i fileDataRegion;
-			const int nchannels = readRegion( tileBatchIndex.z, targetRegion, fileData, fileDataRegion );
+			const int nchannels = readRegion( firstTileBatchIndex.z, targetRegion, fileData, fileDataRegion );
+
+			std::vector<ConstObjectVectorPtr> result;
+			for( const auto &index : indices )
+			{
+				result.push_back( extractTileBatch( index, fileData, fileDataRegion, nchannels ) );
+			}
+			return result;
+		}
+
+		// Pulls the data for a single tile batch out of interleaved file data.
+		ConstObjectVectorPtr extractTileBatch( const V3i &tileBatchIndex, const std::vector<float> &fileData, const Box2i &fileDataRegion, int nchannels ) const
+		{
+			V2i batchFirstTile = V2i( tileBatchIndex.x, tileBatchIndex.y ) * m_tileBatchSize;
+			if( !m_tiled )
+			{
+				batchFirstTile.x = ImagePlug::tileIndex( V2i( m_imageSpec.x, 0 ) ).x;
+			}
 
 			// Pull data apart into tiles ( separate for each channel instead of interleaved )
 			int tileBatchNumElements = nchannels * m_tileBatchSize.y * m_tileBatchSize.x;
@@ -293,7 +604,7 @@ class File
 
 							float *tileIndex = &tile[ y * ImagePlug::tileSize() + tileRegion.min.x ];
 							int scanline = fileDataRegion.size().y - 1 - (y - tileRelativeFileRegion.min.y);
-							float *dataIndex = &fileData[
+							const float *dataIndex = &fileData[
 								( scanline * fileDataRegion.size().x + tileRegion.min.x - tileRelativeFileRegion.min.x
 								) * nchannels + c
 							];
@@ -314,32 +625,135 @@ class File
 			return result;
 		}
 
-		// Given a channelName and tileOrigin, return the information necessary to look up the data for this tile.
-		// The tileBatchIndex is used to find a tileBatch, and then the tileBatchSubIndex tells you the index
-		// within that tile to use
-		void findTile( const std::string &channelName, const Imath::V2i &tileOrigin, V3i &batchIndex, int &batchSubIndex ) const
+		// Removes and returns a batch from read-ahead storage, returning
+		// an invalid future if it hasn't been read ahead.
+		std::shared_future<ConstObjectVectorPtr> takeReadAheadTileBatch( const V3i &tileBatchIndex )
 		{
-			ChannelMapEntry channelMapEntry = m_channelMap.at( channelName );
-			batchIndex = tileBatchIndex( channelMapEntry.subImage, tileOrigin );
-			batchSubIndex = tileBatchSubIndex( channelMapEntry.channelIndex, tileOrigin );
-		}
+			std::lock_guard<std::mutex> lock( m_readAheadMutex );
+			auto it = m_readAheadBatches.find( tileBatchIndex );
+			if( it == m_readAheadBatches.end() )
+			{
+				return std::shared_future<ConstObjectVectorPtr>();
+			}
 
-		const ImageSpec &imageSpec() const
-		{
-			return m_imageSpec;
+			std::shared_future<ConstObjectVectorPtr> result = it->second.future;
+			releaseReadAheadMemory( it->second.bytes );
+			m_readAheadBatches.erase( it );
+			return result;
 		}
 
-		std::string formatName() const
+		void scheduleReadAhead( const V3i &tileBatchIndex, int readAhead )
 		{
-			return m_imageInput->format_name();
-		}
+			readAhead = std::min( readAhead, (int)g_maxReadAheadBatches / 2 );
+			std::lock_guard<std::mutex> lock( m_readAheadMutex );
+
+			// Discard completed batches that are behind the current read
+			// position, or too far ahead of it. They are unlikely to be
+			// requested, probably because they are already in Gaffer's cache.
+			std::set<V3i, TileBatchIndexLess> window;
+			V3i index = tileBatchIndex;
+			for( int i = 0; i < readAhead; ++i )
+			{
+				index = nextTileBatchIndex( index );
+				window.insert( index );
+			}
 
-		ConstStringVectorDataPtr channelNamesData()
-		{
-			return m_channelNamesData;
-		}
+			for( auto it = m_readAheadBatches.begin(); it != m_readAheadBatches.end(); )
+			{
+				if( !window.count( it->first ) && it->second.future.wait_for( std::chrono::seconds( 0 ) ) == std::future_status::ready )
+				{
+					releaseReadAheadMemory( it->second.bytes );
+					it = m_readAheadBatches.erase( it );
+				}
+				else
+				{
+					++it;
+				}
+			}
 
-	private:
+			// Find the batches that need reading. We only start another
+			// read once half of the previous read-ahead has been consumed,
+			// so that each read covers several batches.
+
+			std::vector<V3i> indices;
+			int numPending = 0;
+			index = tileBatchIndex;
+			for( int i = 0; i < readAhead; ++i )
+			{
+				index = nextTileBatchIndex( index );
+				if( !validTileBatchIndex( index ) )
+				{
+					break;
+				}
+				else if( m_readAheadBatches.count( index ) )
+				{
+					if( indices.size() )
+					{
+						// Batches must be contiguous to be read together.
+						break;
+					}
+					numPending++;
+				}
+				else
+				{
+					indices.push_back( index );
+				}
+			}
+
+			if( indices.empty() || numPending > readAhead / 2 || m_readAheadBatches.size() + indices.size() > g_maxReadAheadBatches )
+			{
+				return;
+			}
+
+			// All the batches are from the same subimage, so have the same size.
+			const size_t batchBytes = tileBatchBytes( indices.front().z );
+			if( !reserveReadAheadMemory( batchBytes * indices.size() ) )
+			{
+				return;
+			}
+
+			using Promise = std::promise<ConstObjectVectorPtr>;
+			std::vector<std::shared_ptr<Promise>> promises;
+			for( const auto &i : indices )
+			{
+				promises.push_back( std::make_shared<Promise>() );
+				m_readAheadBatches[i] = ReadAheadBatch{ promises.back()->get_future().share(), batchBytes };
+			}
+
+			// Hold a reference to ourselves so we aren't destroyed if we
+			// are evicted from the file cache while the read is pending.
+			std::shared_ptr<File> file = shared_from_this();
+			const bool enqueued = ReadAheadPool::instance().enqueue(
+				[file, indices, promises] {
+					try
+					{
+						std::vector<ConstObjectVectorPtr> batches = file->readTileBatches( indices.front(), indices.size() );
+						g_readAheadReads++;
+						g_readAheadBatchesRead += batches.size();
+						for( size_t i = 0; i < batches.size(); ++i )
+						{
+							promises[i]->set_value( batches[i] );
+						}
+					}
+					catch( ... )
+					{
+						for( const auto &p : promises )
+						{
+							p->set_exception( std::current_exception() );
+						}
+					}
+				}
+			);
+
+			if( !enqueued )
+			{
+				for( const auto &i : indices )
+				{
+					m_readAheadBatches.erase( i );
+				}
+				releaseReadAheadMemory( batchBytes * indices.size() );
+			}
+		}
 
 		// Fill the data array with all data for the specified subImage and target region,
 		// setting the dataRegion to represent the actual bounds of the data read ( which may have had to
@@ -430,6 +844,13 @@ class File
 			return V3i( tileBatchOrigin.x, tileBatchOrigin.y, subImage );
 		}
 
+		// Returns the memory used by a tile batch from the specified subimage.
+		size_t tileBatchBytes( int subImage ) const
+		{
+			const size_t tileBytes = ImagePlug::tileSize() * ImagePlug::tileSize() * sizeof( float );
+			return tileBytes * m_tileBatchSize.x * m_tileBatchSize.y * m_subImageChannelCounts[subImage];
+		}
+
 		// Given a channel index, and a tile origin, return the index within a tile batch where the correct
 		// tile will be found.
 		int tileBatchSubIndex( int channelIndex, V2i tileOrigin ) const
@@ -451,9 +872,22 @@ class File
 		ImageSpec m_imageSpec;
 		ConstStringVectorDataPtr m_channelNamesData;
 		std::map<std::string, ChannelMapEntry> m_channelMap;
+		std::vector<int> m_subImageChannelCounts;
 		Imath::V2i m_tileBatchSize;
+		Imath::Box2i m_tileBatchRange;
 		tbb::mutex m_mutex;
 		bool m_tiled;
+
+		struct ReadAheadBatch
+		{
+			std::shared_future<ConstObjectVectorPtr> future;
+			// Memory reserved for the batch.
+			size_t bytes;
+		};
+
+		typedef std::map<V3i, ReadAheadBatch, TileBatchIndexLess> ReadAheadBatches;
+		ReadAheadBatches m_readAheadBatches;
+		std::mutex m_readAheadMutex;
 };
 
 
@@ -588,6 +1022,7 @@ OpenImageIOReader::OpenImageIOReader( const std::string &name )
 	addChild( new IntPlug( "refreshCount" ) );
 	addChild( new IntPlug( "missingFrameMode", Plug::In, Error, /* min */ Error, /* max */ Hold ) );
 	addChild( new IntVectorDataPlug( "availableFrames", Plug::Out, new IntVectorData ) );
+	addChild( new IntPlug( "readAhead", Plug::In, 0, /* min */ 0 ) );
 	addChild( new ObjectVectorPlug( "__tileBatch", Plug::Out, new ObjectVector ) );
 
 	plugSetSignal().connect( boost::bind( &OpenImageIOReader::plugSet, this, ::_1 ) );
@@ -637,14 +1072,65 @@ const Gaffer::IntVectorDataPlug *OpenImageIOReader::availableFramesPlug() const
 	return getChild<IntVectorDataPlug>( g_firstPlugIndex + 3 );
 }
 
+Gaffer::IntPlug *OpenImageIOReader::readAheadPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 4 );
+}
+
+const Gaffer::IntPlug *OpenImageIOReader::readAheadPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 4 );
+}
+
 Gaffer::ObjectVectorPlug *OpenImageIOReader::tileBatchPlug()
 {
-	return getChild<ObjectVectorPlug>( g_firstPlugIndex + 4 );
+	return getChild<ObjectVectorPlug>( g_firstPlugIndex + 5 );
 }
 
 const Gaffer::ObjectVectorPlug *OpenImageIOReader::tileBatchPlug() const
 {
-	return getChild<ObjectVectorPlug>( g_firstPlugIndex + 4 );
+	return getChild<ObjectVectorPlug>( g_firstPlugIndex + 5 );
+}
+
+void OpenImageIOReader::setReadAheadThreads( size_t numThreads )
+{
+	ReadAheadPool::instance().setNumThreads( numThreads );
+}
+
+size_t OpenImageIOReader::getReadAheadThreads()
+{
+	return ReadAheadPool::instance().getNumThreads();
+}
+
+void OpenImageIOReader::setReadAheadMemoryLimit( size_t bytes )
+{
+	g_readAheadMemoryLimit = bytes;
+}
+
+size_t OpenImageIOReader::getReadAheadMemoryLimit()
+{
+	return g_readAheadMemoryLimit;
+}
+
+size_t OpenImageIOReader::readAheadMemoryUsage()
+{
+	return g_readAheadMemoryUsage;
+}
+
+OpenImageIOReader::ReadAheadStatistics OpenImageIOReader::readAheadStatistics()
+{
+	ReadAheadStatistics result;
+	result.reads = g_readAheadReads;
+	result.batchesRead = g_readAheadBatchesRead;
+	result.batchesUsed = g_readAheadBatchesUsed;
+	return result;
+}
+
+void OpenImageIOReader::resetReadAheadStatistics()
+{
+	g_readAheadReads = 0;
+	g_readAheadBatchesRead = 0;
+	g_readAheadBatchesUsed = 0;
 }
 
 size_t OpenImageIOReader::supportedExtensions( std::vector<std::string> &extensions )
@@ -743,8 +1229,12 @@ void OpenImageIOReader::compute( ValuePlug *output, const Context *context ) con
 			throw IECore::Exception( "OpenImageIOReader - trying to evaluate tileBatchPlug() with invalid file, this should never happen." );
 		}
 
+		// Read-ahead has no effect on the result, so is deliberately
+		// omitted from the hash.
+		const int readAhead = readAheadPlug()->getValue();
+
 		static_cast<ObjectVectorPlug *>( output )->setValue(
-			file->readTileBatch( tileBatchIndex )
+			file->readTileBatch( tileBatchIndex, readAhead )
 		);
 	}
 	else
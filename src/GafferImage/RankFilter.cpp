@@ -42,6 +42,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cmath>
 
 using namespace std;
 using namespace Imath;
@@ -49,6 +50,320 @@ using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Windows larger than this are processed using the sliding window algorithms,
+// which have a higher fixed cost but scale much better with the radius.
+const int g_slidingWindowThreshold = 25;
+
+bool useSlidingWindow( const V2i &radius )
+{
+	return ( 2 * radius.x + 1 ) * ( 2 * radius.y + 1 ) > g_slidingWindowThreshold;
+}
+
+// Copies all the pixels in `bound` into a contiguous buffer, so that each
+// is sampled only once. Returns false if a NaN is encountered.
+bool gatherPixels( Sampler &sampler, const Box2i &bound, vector<float> &pixels, const Canceller *canceller )
+{
+	pixels.resize( bound.size().x * bound.size().y );
+	vector<float>::iterator it = pixels.begin();
+	for( int y = bound.min.y; y < bound.max.y; ++y )
+	{
+		Canceller::check( canceller );
+		for( int x = bound.min.x; x < bound.max.x; ++x )
+		{
+			const float v = sampler.sample( x, y );
+			if( std::isnan( v ) )
+			{
+				return false;
+			}
+			*it++ = v;
+		}
+	}
+	return true;
+}
+
+// Returns the sorted unique values from `pixels`. The sort is performed in
+// chunks which are then merged, so that we can respond to cancellation
+// promptly even for very large radii.
+vector<float> sortedUniqueValues( const vector<float> &pixels, const Canceller *canceller )
+{
+	vector<float> result( pixels );
+
+	const size_t chunkSize = 1 << 16;
+	for( size_t i = 0; i < result.size(); i += chunkSize )
+	{
+		Canceller::check( canceller );
+		std::sort( result.begin() + i, result.begin() + std::min( i + chunkSize, result.size() ) );
+	}
+
+	for( size_t width = chunkSize; width < result.size(); width *= 2 )
+	{
+		for( size_t i = 0; i + width < result.size(); i += 2 * width )
+		{
+			Canceller::check( canceller );
+			std::inplace_merge( result.begin() + i, result.begin() + i + width, result.begin() + std::min( i + 2 * width, result.size() ) );
+		}
+	}
+
+	result.erase( std::unique( result.begin(), result.end() ), result.end() );
+	return result;
+}
+
+// Histogram of pixel ranks, with a coarse level to accelerate
+// the search for the nth element.
+class RankHistogram
+{
+
+	public :
+
+		RankHistogram( size_t numRanks )
+			:	m_coarseShift( 0 ), m_fine( numRanks, 0 )
+		{
+			while( ( (size_t)1 << ( 2 * m_coarseShift ) ) < numRanks )
+			{
+				m_coarseShift++;
+			}
+			m_coarse.resize( ( numRanks >> m_coarseShift ) + 1, 0 );
+		}
+
+		void add( int rank )
+		{
+			m_fine[rank]++;
+			m_coarse[rank >> m_coarseShift]++;
+		}
+
+		void remove( int rank )
+		{
+			m_fine[rank]--;
+			m_coarse[rank >> m_coarseShift]--;
+		}
+
+		// Returns the rank of the nth smallest element, counting from 0.
+		int nth( int n ) const
+		{
+			size_t c = 0;
+			while( n >= m_coarse[c] )
+			{
+				n -= m_coarse[c++];
+			}
+			size_t f = c << m_coarseShift;
+			while( n >= m_fine[f] )
+			{
+				n -= m_fine[f++];
+			}
+			return f;
+		}
+
+	private :
+
+		int m_coarseShift;
+		vector<int> m_fine;
+		vector<int> m_coarse;
+
+};
+
+// Computes the exact median using Huang's sliding histogram algorithm.
+// Since arbitrary floats can't be binned directly, we bin the ranks of
+// the values instead. The window is moved in a serpentine pattern so that
+// each step only needs to update a single row or column of the histogram.
+void slidingMedian( const vector<float> &pixels, const V2i &radius, vector<float> &result, const Canceller *canceller )
+{
+	const int tileSize = ImagePlug::tileSize();
+	const int width = tileSize + 2 * radius.x;
+	const V2i windowSize = radius * 2 + V2i( 1 );
+	const int medianIndex = windowSize.x * windowSize.y / 2;
+
+	const vector<float> values = sortedUniqueValues( pixels, canceller );
+	vector<int> ranks( pixels.size() );
+	for( size_t i = 0; i < pixels.size(); ++i )
+	{
+		if( i % width == 0 )
+		{
+			Canceller::check( canceller );
+		}
+		ranks[i] = lower_bound( values.begin(), values.end(), pixels[i] ) - values.begin();
+	}
+
+	auto rank = [&ranks, width] ( int x, int y ) {
+		return ranks[y * width + x];
+	};
+
+	RankHistogram histogram( values.size() );
+	for( int y = 0; y < windowSize.y; ++y )
+	{
+		Canceller::check( canceller );
+		for( int x = 0; x < windowSize.x; ++x )
+		{
+			histogram.add( rank( x, y ) );
+		}
+	}
+
+	result.resize( tileSize * tileSize );
+
+	int x = 0;
+	for( int y = 0; y < tileSize; ++y )
+	{
+		Canceller::check( canceller );
+
+		if( y > 0 )
+		{
+			// Move window up a row
+			for( int wx = x; wx < x + windowSize.x; ++wx )
+			{
+				histogram.remove( rank( wx, y - 1 ) );
+				histogram.add( rank( wx, y - 1 + windowSize.y ) );
+			}
+		}
+
+		const int step = y % 2 ? -1 : 1;
+		while( true )
+		{
+			result[y * tileSize + x] = values[histogram.nth( medianIndex )];
+
+			const int nextX = x + step;
+			if( nextX < 0 || nextX >= tileSize )
+			{
+				break;
+			}
+
+			// Move window along the row
+			const int removeX = step > 0 ? x : x + windowSize.x - 1;
+			const int addX = step > 0 ? x + windowSize.x : nextX;
+			for( int wy = y; wy < y + windowSize.y; ++wy )
+			{
+				histogram.remove( rank( removeX, wy ) );
+				histogram.add( rank( addX, wy ) );
+			}
+			x = nextX;
+		}
+	}
+}
+
+// Computes the extreme value of each window of `2 * radius + 1` consecutive
+// elements, using the van Herk/Gil-Werman algorithm. Reads `n + 2 * radius`
+// elements from `in` and writes `n` elements to `out`.
+template<typename Select>
+void slidingExtreme1D( const float *in, int inStride, float *out, int outStride, int n, int radius, vector<float> &prefix, vector<float> &suffix, Select select )
+{
+	const int windowSize = 2 * radius + 1;
+	const int size = n + 2 * radius;
+	prefix.resize( size );
+	suffix.resize( size );
+
+	for( int i = 0; i < size; ++i )
+	{
+		const float v = in[i * inStride];
+		prefix[i] = i % windowSize ? select( prefix[i-1], v ) : v;
+	}
+
+	for( int i = size - 1; i >= 0; --i )
+	{
+		const float v = in[i * inStride];
+		suffix[i] = ( i == size - 1 || ( i + 1 ) % windowSize == 0 ) ? v : select( suffix[i+1], v );
+	}
+
+	for( int i = 0; i < n; ++i )
+	{
+		out[i * outStride] = select( suffix[i], prefix[i + windowSize - 1] );
+	}
+}
+
+// Computes the minimum or maximum over the window, performing
+// separate horizontal and vertical passes.
+template<typename Select>
+void slidingExtreme( const vector<float> &pixels, const V2i &radius, vector<float> &result, Select select, const Canceller *canceller )
+{
+	const int tileSize = ImagePlug::tileSize();
+	const int width = tileSize + 2 * radius.x;
+	const int height = tileSize + 2 * radius.y;
+
+	vector<float> prefix;
+	vector<float> suffix;
+
+	vector<float> horizontal( tileSize * height );
+	for( int y = 0; y < height; ++y )
+	{
+		Canceller::check( canceller );
+		slidingExtreme1D( &pixels[y * width], 1, &horizontal[y * tileSize], 1, tileSize, radius.x, prefix, suffix, select );
+	}
+
+	result.resize( tileSize * tileSize );
+	for( int x = 0; x < tileSize; ++x )
+	{
+		Canceller::check( canceller );
+		slidingExtreme1D( &horizontal[x], tileSize, &result[x], tileSize, tileSize, radius.y, prefix, suffix, select );
+	}
+}
+
+// Returns the offset to the pixel within the window which matches `value`,
+// choosing between multiple matches in exactly the same way as the brute force
+// search in `RankFilter::compute()`. Searches outwards from the center, so that
+// we can usually terminate early.
+V2i closestOffset( const vector<float> &pixels, int width, const V2i &center, const V2i &radius, float value )
+{
+	V2i result( INT_MAX, INT_MAX );
+	int closestMatch = INT_MAX;
+	int closestScanIndex = INT_MAX;
+
+	auto consider = [&] ( const V2i &o ) {
+		if( pixels[( center.y + o.y ) * width + center.x + o.x] != value )
+		{
+			return;
+		}
+		const int absX = abs( o.x );
+		const int absY = abs( o.y );
+		const int distance = 100 * max( absX, absY ) + absX + absY;
+		// The brute force search takes the first match in scanline order
+		// when distances are equal.
+		const int scanIndex = ( o.y + radius.y ) * ( 2 * radius.x + 1 ) + o.x + radius.x;
+		if( distance < closestMatch || ( distance == closestMatch && scanIndex < closestScanIndex ) )
+		{
+			closestMatch = distance;
+			closestScanIndex = scanIndex;
+			result = o;
+		}
+	};
+
+	for( int d = 0, maxD = max( radius.x, radius.y ); d <= maxD; ++d )
+	{
+		// No pixel in this ring can be closer than `101 * d`.
+		if( 101 * d > closestMatch )
+		{
+			break;
+		}
+
+		for( int y = max( -d, -radius.y ); y <= min( d, radius.y ); ++y )
+		{
+			if( abs( y ) == d )
+			{
+				for( int x = max( -d, -radius.x ); x <= min( d, radius.x ); ++x )
+				{
+					consider( V2i( x, y ) );
+				}
+			}
+			else if( d <= radius.x )
+			{
+				consider( V2i( -d, y ) );
+				consider( V2i( d, y ) );
+			}
+		}
+	}
+
+	return result;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// RankFilter
+//////////////////////////////////////////////////////////////////////////
+
 IE_CORE_DEFINERUNTIMETYPED( RankFilter );
 
 size_t RankFilter::g_firstPlugIndex = 0;
@@ -224,6 +539,29 @@ void RankFilter::compute( Gaffer::ValuePlug *output, const Gaffer::Context *cont
 		vector<V2i> &result = resultData->writable();
 		result.reserve( ImagePlug::tileSize() * ImagePlug::tileSize() );
 
+		if( useSlidingWindow( radius ) )
+		{
+			vector<float> inputPixels;
+			vector<float> ranks;
+			if( slidingWindowRanks( sampler, inputBound, radius, inputPixels, ranks, context ) )
+			{
+				const int width = inputBound.size().x;
+				vector<float>::const_iterator ranksIt = ranks.begin();
+				V2i p;
+				for( p.y = 0; p.y < ImagePlug::tileSize(); ++p.y )
+				{
+					IECore::Canceller::check( context->canceller() );
+					for( p.x = 0; p.x < ImagePlug::tileSize(); ++p.x )
+					{
+						result.push_back( closestOffset( inputPixels, width, p + radius, radius, *ranksIt++ ) );
+					}
+				}
+
+				static_cast<V2iVectorDataPlug *>( output )->setValue( resultData );
+				return;
+			}
+		}
+
 		vector<float> pixels( ( 1 + 2 * radius.x ) * ( 1 + 2 * radius.y ) );
 		vector<float> sortPixels( ( 1 + 2 * radius.x ) * ( 1 + 2 * radius.y ) );
 		vector<float>::iterator resultIt = sortPixels.begin() + sortPixels.size() / 2;
@@ -397,6 +735,15 @@ IECore::ConstFloatVectorDataPtr RankFilter::computeChannelData( const std::strin
 		return resultData;
 	}
 
+	if( useSlidingWindow( radius ) )
+	{
+		vector<float> inputPixels;
+		if( slidingWindowRanks( sampler, inputBound, radius, inputPixels, result, context ) )
+		{
+			return resultData;
+		}
+	}
+
 	vector<float> pixels( ( 1 + 2 * radius.x ) * ( 1 + 2 * radius.y ) );
 	vector<float>::iterator resultIt = pixels.begin() + pixels.size() / 2;
 
@@ -434,3 +781,26 @@ IECore::ConstFloatVectorDataPtr RankFilter::computeChannelData( const std::strin
 
 	return resultData;
 }
+
+bool RankFilter::slidingWindowRanks( Sampler &sampler, const Imath::Box2i &inputBound, const Imath::V2i &radius, std::vector<float> &inputPixels, std::vector<float> &ranks, const Gaffer::Context *context ) const
+{
+	if( !gatherPixels( sampler, inputBound, inputPixels, context->canceller() ) )
+	{
+		return false;
+	}
+
+	switch( m_mode )
+	{
+		case MedianRank :
+			slidingMedian( inputPixels, radius, ranks, context->canceller() );
+			break;
+		case ErodeRank :
+			slidingExtreme( inputPixels, radius, ranks, [] ( float a, float b ) { return std::min( a, b ); }, context->canceller() );
+			break;
+		case DilateRank :
+			slidingExtreme( inputPixels, radius, ranks, [] ( float a, float b ) { return std::max( a, b ); }, context->canceller() );
+			break;
+	}
+
+	return true;
+}
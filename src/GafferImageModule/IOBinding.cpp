@@ -127,6 +127,26 @@ void GafferImageModule::bindIO()
 		scope s = GafferBindings::DependencyNodeClass<OpenImageIOReader>()
 			.def( "supportedExtensions", &supportedExtensions<OpenImageIOReader> )
 			.staticmethod( "supportedExtensions" )
+			.def( "setReadAheadThreads", &OpenImageIOReader::setReadAheadThreads )
+			.staticmethod( "setReadAheadThreads" )
+			.def( "getReadAheadThreads", &OpenImageIOReader::getReadAheadThreads )
+			.staticmethod( "getReadAheadThreads" )
+			.def( "setReadAheadMemoryLimit", &OpenImageIOReader::setReadAheadMemoryLimit )
+			.staticmethod( "setReadAheadMemoryLimit" )
+			.def( "getReadAheadMemoryLimit", &OpenImageIOReader::getReadAheadMemoryLimit )
+			.staticmethod( "getReadAheadMemoryLimit" )
+			.def( "readAheadMemoryUsage", &OpenImageIOReader::readAheadMemoryUsage )
+			.staticmethod( "readAheadMemoryUsage" )
+			.def( "readAheadStatistics", &OpenImageIOReader::readAheadStatistics )
+			.staticmethod( "readAheadStatistics" )
+			.def( "resetReadAheadStatistics", &OpenImageIOReader::resetReadAheadStatistics )
+			.staticmethod( "resetReadAheadStatistics" )
+		;
+
+		class_<OpenImageIOReader::ReadAheadStatistics>( "ReadAheadStatistics" )
+			.def_readonly( "reads", &OpenImageIOReader::ReadAheadStatistics::reads )
+			.def_readonly( "batchesRead", &OpenImageIOReader::ReadAheadStatistics::batchesRead )
+			.def_readonly( "batchesUsed", &OpenImageIOReader::ReadAheadStatistics::batchesUsed )
 		;
 
 		enum_<OpenImageIOReader::MissingFrameMode>( "MissingFrameMode" )
@@ -41,11 +41,15 @@
 #include "GafferImage/ImageAlgo.h"
 #include "GafferImage/ImagePlug.h"
 
+#include "Gaffer/Context.h"
 #include "Gaffer/Node.h"
 
 #include "IECorePython/RefCountedBinding.h"
 #include "IECorePython/ScopedGILRelease.h"
 
+#include "tbb/spin_mutex.h"
+#include "tbb/task_arena.h"
+
 using namespace boost::python;
 using namespace Gaffer;
 using namespace GafferImage;
@@ -99,6 +103,54 @@ boost::signals::connection connectProcessTilesToPlugDirtiedSignal( GafferImage::
 	return const_cast<Node *>( node )->plugDirtiedSignal().connect( boost::bind( &processTilesOnDirty, ::_1, image ) );
 }
 
+// Processes the specified tiles using the ordered form of `parallelProcessTiles()`,
+// returning a list of `( tileOrigin, contextTileOrigin )` tuples in the order in which
+// the functor was called. When `serial` is true, processing is limited to a single
+// thread, so that the order of the calls matches the order of the input.
+boost::python::list processTilesInOrder( const GafferImage::ImagePlug *imagePlug, const boost::python::list &pythonTileOrigins, bool serial )
+{
+	std::vector<Imath::V2i> tileOrigins;
+	for( size_t i = 0, e = len( pythonTileOrigins ); i < e; ++i )
+	{
+		tileOrigins.push_back( extract<Imath::V2i>( pythonTileOrigins[i] ) );
+	}
+
+	typedef std::pair<Imath::V2i, Imath::V2i> Call;
+	std::vector<Call> calls;
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+
+		tbb::spin_mutex mutex;
+		auto process = [&] {
+			ImageAlgo::parallelProcessTiles(
+				imagePlug, tileOrigins,
+				[&] ( const GafferImage::ImagePlug *imagePlug, const Imath::V2i &tileOrigin ) {
+					const Imath::V2i contextTileOrigin = Context::current()->get<Imath::V2i>( ImagePlug::tileOriginContextName );
+					tbb::spin_mutex::scoped_lock lock( mutex );
+					calls.push_back( Call( tileOrigin, contextTileOrigin ) );
+				}
+			);
+		};
+
+		if( serial )
+		{
+			tbb::task_arena arena( 1 );
+			arena.execute( process );
+		}
+		else
+		{
+			process();
+		}
+	}
+
+	boost::python::list result;
+	for( const auto &call : calls )
+	{
+		result.append( boost::python::make_tuple( call.first, call.second ) );
+	}
+	return result;
+}
+
 } // namespace
 
 BOOST_PYTHON_MODULE( _GafferImageTest )
@@ -109,4 +161,5 @@ BOOST_PYTHON_MODULE( _GafferImageTest )
 
 	def( "processTiles", &processTilesWrapper );
 	def( "connectProcessTilesToPlugDirtiedSignal", &connectProcessTilesToPlugDirtiedSignal );
+	def( "processTilesInOrder", &processTilesInOrder, ( arg( "imagePlug" ), arg( "tileOrigins" ), arg( "serial" ) = false ) );
 }
@@ -268,6 +268,13 @@ Imath::Box3f ImageGadget::bound() const
 	);
 }
 
+Imath::Box3f ImageGadget::renderBound() const
+{
+	Box3f b;
+	b.makeInfinite();
+	return b;
+}
+
 void ImageGadget::plugDirtied( const Gaffer::Plug *plug )
 {
 	if( plug == m_image->formatPlug() )
@@ -452,38 +459,46 @@ void ImageGadget::Tile::applyUpdates( const std::vector<Update> &updates )
 	}
 }
 
-const IECoreGL::Texture *ImageGadget::Tile::texture( bool &active )
+bool ImageGadget::Tile::updateTexture()
 {
-	const auto now = std::chrono::steady_clock::now();
 	Mutex::scoped_lock lock( m_mutex );
-	if( m_active && ( now - m_activeStartTime ) > std::chrono::milliseconds( 20 ) )
-	{
-		// We don't draw a tile as active until after a short delay, to avoid
-		// distractions when the image generation is really fast anyway.
-		active = true;
-	}
-
 	ConstFloatVectorDataPtr channelDataToConvert = m_channelDataToConvert;
 	m_channelDataToConvert = nullptr;
 	lock.release(); // Don't hold lock while doing expensive conversion
 
-	if( channelDataToConvert )
+	if( !channelDataToConvert )
 	{
-		GLuint texture;
-		glGenTextures( 1, &texture );
-		m_texture = new Texture( texture ); // Lock not needed, because this is only touched on the UI thread.
-		Texture::ScopedBinding binding( *m_texture );
+		return false;
+	}
 
-		glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
-		glTexImage2D(
-			GL_TEXTURE_2D, 0, GL_LUMINANCE, ImagePlug::tileSize(), ImagePlug::tileSize(), 0, GL_LUMINANCE,
-			GL_FLOAT, channelDataToConvert->readable().data()
-		);
+	GLuint texture;
+	glGenTextures( 1, &texture );
+	m_texture = new Texture( texture ); // Lock not needed, because this is only touched on the UI thread.
+	Texture::ScopedBinding binding( *m_texture );
+
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+	glTexImage2D(
+		GL_TEXTURE_2D, 0, GL_LUMINANCE, ImagePlug::tileSize(), ImagePlug::tileSize(), 0, GL_LUMINANCE,
+		GL_FLOAT, channelDataToConvert->readable().data()
+	);
+
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
 
-		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
-		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
-		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
-		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+	return true;
+}
+
+const IECoreGL::Texture *ImageGadget::Tile::texture( bool &active )
+{
+	const auto now = std::chrono::steady_clock::now();
+	Mutex::scoped_lock lock( m_mutex );
+	if( m_active && ( now - m_activeStartTime ) > std::chrono::milliseconds( 20 ) )
+	{
+		// We don't draw a tile as active until after a short delay, to avoid
+		// distractions when the image generation is really fast anyway.
+		active = true;
 	}
 
 	return m_texture ? m_texture.get() : blackTexture();
@@ -500,14 +515,21 @@ inline size_t GafferImageUI::tbb_hasher( const ImageGadget::TileIndex &tileIndex
 
 void ImageGadget::updateTiles()
 {
-	if( !(m_dirtyFlags & TilesDirty) )
+	if( m_paused )
 	{
 		return;
 	}
 
-	if( m_paused )
+	const Box2i region = visibleRegion();
+	if( !(m_dirtyFlags & TilesDirty) )
 	{
-		return;
+		if( BufferAlgo::contains( m_tilesRegion, region ) )
+		{
+			return;
+		}
+		// The view has changed to reveal tiles that
+		// we haven't computed yet.
+		m_dirtyFlags |= TilesDirty;
 	}
 
 	if( m_tilesTask )
@@ -515,13 +537,30 @@ void ImageGadget::updateTiles()
 		const auto status = m_tilesTask->status();
 		if( status == BackgroundTask::Pending || status == BackgroundTask::Running )
 		{
-			return;
+			if( BufferAlgo::contains( m_tilesRegion, region ) )
+			{
+				return;
+			}
+			// The current update won't compute all the tiles
+			// we need, so cancel it and start another.
+			m_tilesTask.reset();
 		}
 	}
 
 	stateChangedSignal()( this );
 	removeOutOfBoundsTiles();
 
+	m_tilesRegion = region;
+	if( BufferAlgo::empty( region ) )
+	{
+		// Nothing visible, so nothing to compute. We mustn't
+		// pass an empty window to `parallelProcessTiles()`,
+		// because it would process the whole data window.
+		m_dirtyFlags &= ~TilesDirty;
+		stateChangedSignal()( this );
+		return;
+	}
+
 	// Decide which channels to compute. This is the intersection
 	// of the available channels (channelNames) and the channels
 	// we want to display (m_rgbaChannels).
@@ -538,8 +577,6 @@ void ImageGadget::updateTiles()
 		}
 	}
 
-	const Box2i dataWindow = this->dataWindow();
-
 	// Do the actual work of generating the tiles asynchronously,
 	// in the background.
 
@@ -555,28 +592,21 @@ void ImageGadget::updateTiles()
 		}
 
 		Tile::applyUpdates( updates );
-
-		if( refCount() && !m_renderRequestPending.exchange( true ) )
-		{
-			// Must hold a reference to stop us dying before our UI thread call is scheduled.
-			ImageGadgetPtr thisRef = this;
-			ParallelAlgo::callOnUIThread(
-				[thisRef] {
-					thisRef->m_renderRequestPending = false;
-					thisRef->requestRender();
-				}
-			);
-		}
+		requestRenderOnUIThread();
 	};
 
+	// Compute the tiles in order of priority, so the user
+	// sees the most important part of the image first.
+	const vector<V2i> tileOrigins = prioritisedTileOrigins( region );
+
 	Context::Scope scopedContext( m_context.get() );
 	m_tilesTask = ParallelAlgo::callOnBackgroundThread(
 		// Subject
 		m_image.get(),
 		// OK to capture `this` via raw pointer, because ~ImageGadget waits for
 		// the background process to complete.
-		[this, channelsToCompute, dataWindow, tileFunctor] {
-			ImageAlgo::parallelProcessTiles( m_image.get(), tileFunctor, dataWindow );
+		[this, tileOrigins, tileFunctor] {
+			ImageAlgo::parallelProcessTiles( m_image.get(), tileOrigins, tileFunctor );
 			m_dirtyFlags &= ~TilesDirty;
 			if( refCount() )
 			{
@@ -617,6 +647,118 @@ void ImageGadget::removeOutOfBoundsTiles() const
 	}
 }
 
+Imath::Box2f ImageGadget::visibleBound() const
+{
+	const ViewportGadget *viewport = ancestor<ViewportGadget>();
+	if( !viewport )
+	{
+		return Box2f();
+	}
+
+	const V2f viewportSize( viewport->getViewport() );
+	Box2f result;
+	for( const auto &corner : { V2f( 0 ), V2f( viewportSize.x, 0 ), V2f( 0, viewportSize.y ), viewportSize } )
+	{
+		result.extendBy( pixelAt( viewport->rasterToGadgetSpace( corner, this ) ) );
+	}
+
+	return result;
+}
+
+Imath::Box2i ImageGadget::visibleRegion() const
+{
+	const Box2i &dataWindow = this->dataWindow();
+	const Box2f visibleBound = this->visibleBound();
+	if( visibleBound.isEmpty() )
+	{
+		return dataWindow;
+	}
+
+	const int tileSize = ImagePlug::tileSize();
+	const Box2i paddedBound(
+		V2i( (int)floorf( visibleBound.min.x ), (int)floorf( visibleBound.min.y ) ) - V2i( tileSize ),
+		V2i( (int)ceilf( visibleBound.max.x ), (int)ceilf( visibleBound.max.y ) ) + V2i( tileSize )
+	);
+
+	const Box2i result = BufferAlgo::intersection( paddedBound, dataWindow );
+	// Normalise empty regions so that they are contained by any other.
+	return BufferAlgo::empty( result ) ? Box2i() : result;
+}
+
+const std::vector<Imath::V2i> &ImageGadget::prioritisedTileOrigins( const Imath::Box2i &region ) const
+{
+	// Prioritise tiles that are actually visible over those
+	// in the padding around the visible region, and order each
+	// group by distance from the centre of the view.
+
+	Box2f visibleBound = this->visibleBound();
+	if( visibleBound.isEmpty() )
+	{
+		visibleBound = Box2f( V2f( region.min ), V2f( region.max ) );
+	}
+
+	// We're called for every redraw, but the order only changes
+	// when the view does, so we reuse the previous result if we can.
+	if( region == m_prioritisedTilesRegion && visibleBound == m_prioritisedVisibleBound )
+	{
+		return m_prioritisedTileOrigins;
+	}
+
+	m_prioritisedTilesRegion = region;
+	m_prioritisedVisibleBound = visibleBound;
+	vector<V2i> &result = m_prioritisedTileOrigins;
+	result.clear();
+	if( BufferAlgo::empty( region ) )
+	{
+		return result;
+	}
+
+	const int tileSize = ImagePlug::tileSize();
+	const V2i minOrigin = ImagePlug::tileOrigin( region.min );
+	const V2i maxOrigin = ImagePlug::tileOrigin( region.max - V2i( 1 ) );
+	for( V2i tileOrigin = minOrigin; tileOrigin.y <= maxOrigin.y; tileOrigin.y += tileSize )
+	{
+		for( tileOrigin.x = minOrigin.x; tileOrigin.x <= maxOrigin.x; tileOrigin.x += tileSize )
+		{
+			result.push_back( tileOrigin );
+		}
+	}
+
+	const V2f center = visibleBound.center();
+
+	auto priority = [&visibleBound, &center, tileSize] ( const V2i &tileOrigin ) {
+		const Box2f tileBound( V2f( tileOrigin ), V2f( tileOrigin + V2i( tileSize ) ) );
+		return std::make_pair(
+			!tileBound.intersects( visibleBound ),
+			( tileBound.center() - center ).length2()
+		);
+	};
+
+	std::sort(
+		result.begin(), result.end(),
+		[&priority] ( const V2i &a, const V2i &b ) {
+			return priority( a ) < priority( b );
+		}
+	);
+
+	return result;
+}
+
+void ImageGadget::requestRenderOnUIThread()
+{
+	if( refCount() && !m_renderRequestPending.exchange( true ) )
+	{
+		// Must hold a reference to stop us dying before our UI thread call is scheduled.
+		ImageGadgetPtr thisRef = this;
+		ParallelAlgo::callOnUIThread(
+			[thisRef] {
+				thisRef->m_renderRequestPending = false;
+				thisRef->requestRender();
+			}
+		);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Rendering
 //////////////////////////////////////////////////////////////////////////
@@ -714,6 +856,38 @@ void ImageGadget::visibilityChanged()
 	}
 }
 
+bool ImageGadget::updateTextures( const Imath::Box2i &region ) const
+{
+	// Texture conversion must happen on the UI thread, and when a
+	// large update arrives all at once it could otherwise stall the UI
+	// for a noticeable time. So we convert tiles in order of priority,
+	// and leave the remainder for subsequent renders once our budget
+	// is used up.
+	const auto budget = std::chrono::milliseconds( 10 );
+	const auto startTime = std::chrono::steady_clock::now();
+
+	for( const auto &tileOrigin : prioritisedTileOrigins( region ) )
+	{
+		bool updated = false;
+		for( int i = 0; i < 4; ++i )
+		{
+			const InternedString channelName = m_soloChannel == -1 ? m_rgbaChannels[i] : m_rgbaChannels[m_soloChannel];
+			Tiles::iterator it = m_tiles.find( TileIndex( tileOrigin, channelName ) );
+			if( it != m_tiles.end() )
+			{
+				updated = it->second.updateTexture() || updated;
+			}
+		}
+
+		if( updated && std::chrono::steady_clock::now() - startTime > budget )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 void ImageGadget::renderTiles() const
 {
 	GLint previousProgram;
@@ -743,12 +917,25 @@ void ImageGadget::renderTiles() const
 	GLint activeParameterLocation = shader->uniformParameter( "activeParam" )->location;
 
 	const Box2i dataWindow = this->dataWindow();
+	const Box2i visibleRegion = this->visibleRegion();
 	const float pixelAspect = this->format().getPixelAspect();
 
-	V2i tileOrigin = ImagePlug::tileOrigin( dataWindow.min );
-	for( ; tileOrigin.y < dataWindow.max.y; tileOrigin.y += ImagePlug::tileSize() )
+	if( BufferAlgo::empty( visibleRegion ) )
+	{
+		glUseProgram( previousProgram );
+		return;
+	}
+
+	if( !updateTextures( visibleRegion ) )
+	{
+		// Arrange to be called again to convert the rest.
+		const_cast<ImageGadget *>( this )->requestRenderOnUIThread();
+	}
+
+	V2i tileOrigin = ImagePlug::tileOrigin( visibleRegion.min );
+	for( ; tileOrigin.y < visibleRegion.max.y; tileOrigin.y += ImagePlug::tileSize() )
 	{
-		for( tileOrigin.x = ImagePlug::tileOrigin( dataWindow.min ).x; tileOrigin.x < dataWindow.max.x; tileOrigin.x += ImagePlug::tileSize() )
+		for( tileOrigin.x = ImagePlug::tileOrigin( visibleRegion.min ).x; tileOrigin.x < visibleRegion.max.x; tileOrigin.x += ImagePlug::tileSize() )
 		{
 			bool active = false;
 			for( int i = 0; i < 4; ++i )
@@ -41,14 +41,23 @@
 #include "GafferBindings/DependencyNodeBinding.h"
 #include "GafferBindings/SignalBinding.h"
 
+#include "Gaffer/Context.h"
 #include "Gaffer/Expression.h"
+#include "Gaffer/NumericPlug.h"
 #include "Gaffer/StringPlug.h"
+#include "Gaffer/TypedPlug.h"
 
 #include "IECorePython/ExceptionAlgo.h"
 #include "IECorePython/RefCountedBinding.h"
 #include "IECorePython/ScopedGILLock.h"
 
 #include "IECore/MessageHandler.h"
+#include "IECore/NullObject.h"
+#include "IECore/SimpleTypedData.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
 
 using namespace boost::python;
 using namespace GafferBindings;
@@ -106,6 +115,432 @@ struct ExpressionChangedSlotCaller
 	}
 };
 
+// Evaluates the instructions generated by `_nativeProgram()` in
+// PythonExpressionEngine.py, replicating the semantics of Python 2
+// arithmetic. Evaluation returns null for anything that can't be
+// replicated exactly (for instance a division by zero, or a context
+// variable of an unsupported type), in which case the expression
+// must be executed by python instead.
+class NativeProgram
+{
+
+	public :
+
+		NativeProgram( object program, size_t numOutputs )
+			:	m_numOutputs( numOutputs )
+		{
+			for( size_t i = 0, e = len( program ); i < e; ++i )
+			{
+				tuple t = extract<tuple>( program[i] );
+				const std::string opcode = extract<std::string>( t[0] );
+
+				Instruction instruction;
+				if( opcode == "constant" )
+				{
+					instruction.opcode = Constant;
+					PyObject *v = object( t[1] ).ptr();
+					if( PyBool_Check( v ) )
+					{
+						instruction.value = Value::boolean( v == Py_True );
+					}
+					else if( PyFloat_Check( v ) )
+					{
+						instruction.value = Value::floatingPoint( PyFloat_AsDouble( v ) );
+					}
+					else
+					{
+						instruction.value = Value::integer( extract<int64_t>( t[1] ) );
+					}
+				}
+				else if( opcode == "plug" )
+				{
+					instruction.opcode = PlugValue;
+					instruction.index = extract<size_t>( t[1] );
+				}
+				else if( opcode == "context" )
+				{
+					instruction.opcode = ContextVariable;
+					instruction.name = extract<std::string>( t[1] )();
+				}
+				else if( opcode == "store" )
+				{
+					instruction.opcode = Store;
+					instruction.index = extract<size_t>( t[1] );
+					if( instruction.index >= m_numOutputs )
+					{
+						throw IECore::Exception( "Output index out of range" );
+					}
+				}
+				else if( opcode == "frame" ) { instruction.opcode = Frame; }
+				else if( opcode == "time" ) { instruction.opcode = Time; }
+				else if( opcode == "framesPerSecond" ) { instruction.opcode = FramesPerSecond; }
+				else if( opcode == "add" ) { instruction.opcode = Add; }
+				else if( opcode == "subtract" ) { instruction.opcode = Subtract; }
+				else if( opcode == "multiply" ) { instruction.opcode = Multiply; }
+				else if( opcode == "divide" ) { instruction.opcode = Divide; }
+				else if( opcode == "negate" ) { instruction.opcode = Negate; }
+				else
+				{
+					throw IECore::Exception( "Unknown opcode \"" + opcode + "\"" );
+				}
+
+				m_instructions.push_back( instruction );
+			}
+		}
+
+		IECore::ObjectVectorPtr evaluate( const Context *context, const std::vector<const ValuePlug *> &proxyInputs ) const
+		{
+			IECore::ObjectVectorPtr result = new IECore::ObjectVector;
+			result->members().resize( m_numOutputs, IECore::NullObject::defaultNullObject() );
+
+			std::vector<Value> stack;
+			stack.reserve( m_instructions.size() );
+
+			for( const auto &instruction : m_instructions )
+			{
+				Value value;
+				switch( instruction.opcode )
+				{
+					case Constant :
+						stack.push_back( instruction.value );
+						break;
+					case PlugValue :
+						if( instruction.index >= proxyInputs.size() || !plugValue( proxyInputs[instruction.index], value ) )
+						{
+							return nullptr;
+						}
+						stack.push_back( value );
+						break;
+					case ContextVariable :
+						if( !contextValue( context->get<IECore::Data>( instruction.name, nullptr ), value ) )
+						{
+							return nullptr;
+						}
+						stack.push_back( value );
+						break;
+					case Frame :
+					case Time :
+					case FramesPerSecond :
+						if( !timeValue( instruction.opcode, context, value ) )
+						{
+							return nullptr;
+						}
+						stack.push_back( value );
+						break;
+					case Add :
+					case Subtract :
+					case Multiply :
+					case Divide :
+					{
+						const Value b = stack.back(); stack.pop_back();
+						const Value a = stack.back(); stack.pop_back();
+						if( !binaryOperation( instruction.opcode, a, b, value ) )
+						{
+							return nullptr;
+						}
+						stack.push_back( value );
+						break;
+					}
+					case Negate :
+						if( stack.back().type == Value::Float )
+						{
+							stack.back().f = -stack.back().f;
+						}
+						else
+						{
+							if( stack.back().i == std::numeric_limits<int64_t>::min() )
+							{
+								return nullptr;
+							}
+							stack.back() = Value::integer( -stack.back().i );
+						}
+						break;
+					case Store :
+					{
+						IECore::ObjectPtr data = valueData( stack.back() );
+						if( !data )
+						{
+							return nullptr;
+						}
+						result->members()[instruction.index] = data;
+						stack.pop_back();
+						break;
+					}
+				}
+			}
+
+			return result;
+		}
+
+		// Applies values in the same way as `PythonExpressionEngine.apply()`,
+		// returning false if the plug or value isn't supported.
+		static bool apply( ValuePlug *proxyOutput, const ValuePlug *topLevelProxyOutput, const IECore::Object *value )
+		{
+			if( proxyOutput != topLevelProxyOutput )
+			{
+				return false;
+			}
+
+			if( IECore::runTimeCast<const IECore::NullObject>( value ) )
+			{
+				proxyOutput->setToDefault();
+				return true;
+			}
+
+			Value v;
+			if( !contextValue( IECore::runTimeCast<const IECore::Data>( value ), v ) )
+			{
+				return false;
+			}
+
+			if( auto floatPlug = IECore::runTimeCast<FloatPlug>( proxyOutput ) )
+			{
+				floatPlug->setValue( v.asFloat() );
+				return true;
+			}
+			else if( auto intPlug = IECore::runTimeCast<IntPlug>( proxyOutput ) )
+			{
+				if( v.type == Value::Float )
+				{
+					// Python's `int()` truncates towards zero.
+					if( !( std::abs( v.f ) < std::numeric_limits<int>::max() ) )
+					{
+						return false;
+					}
+					intPlug->setValue( static_cast<int>( v.f ) );
+				}
+				else
+				{
+					intPlug->setValue( v.i );
+				}
+				return true;
+			}
+			else if( auto boolPlug = IECore::runTimeCast<BoolPlug>( proxyOutput ) )
+			{
+				if( v.type != Value::Bool )
+				{
+					return false;
+				}
+				boolPlug->setValue( v.i );
+				return true;
+			}
+
+			return false;
+		}
+
+	private :
+
+		enum Opcode
+		{
+			Constant,
+			PlugValue,
+			ContextVariable,
+			Frame,
+			Time,
+			FramesPerSecond,
+			Add,
+			Subtract,
+			Multiply,
+			Divide,
+			Negate,
+			Store
+		};
+
+		// Equivalent to a Python bool, int or float.
+		struct Value
+		{
+			enum Type { Bool, Int, Float };
+
+			Type type;
+			int64_t i;
+			double f;
+
+			static Value boolean( bool b ) { return { Bool, b, 0 }; }
+			static Value integer( int64_t i ) { return { Int, i, 0 }; }
+			static Value floatingPoint( double f ) { return { Float, 0, f }; }
+
+			double asFloat() const { return type == Float ? f : (double)i; }
+		};
+
+		struct Instruction
+		{
+			Opcode opcode;
+			Value value;
+			size_t index;
+			IECore::InternedString name;
+		};
+
+		static bool plugValue( const ValuePlug *plug, Value &value )
+		{
+			switch( (Gaffer::TypeId)plug->typeId() )
+			{
+				case FloatPlugTypeId :
+					value = Value::floatingPoint( static_cast<const FloatPlug *>( plug )->getValue() );
+					return true;
+				case IntPlugTypeId :
+					value = Value::integer( static_cast<const IntPlug *>( plug )->getValue() );
+					return true;
+				case BoolPlugTypeId :
+					value = Value::boolean( static_cast<const BoolPlug *>( plug )->getValue() );
+					return true;
+				default :
+					return false;
+			}
+		}
+
+		static bool contextValue( const IECore::Data *data, Value &value )
+		{
+			if( !data )
+			{
+				return false;
+			}
+
+			switch( (IECore::TypeId)data->typeId() )
+			{
+				case IECore::FloatDataTypeId :
+					value = Value::floatingPoint( static_cast<const IECore::FloatData *>( data )->readable() );
+					return true;
+				case IECore::DoubleDataTypeId :
+					value = Value::floatingPoint( static_cast<const IECore::DoubleData *>( data )->readable() );
+					return true;
+				case IECore::IntDataTypeId :
+					value = Value::integer( static_cast<const IECore::IntData *>( data )->readable() );
+					return true;
+				case IECore::BoolDataTypeId :
+					value = Value::boolean( static_cast<const IECore::BoolData *>( data )->readable() );
+					return true;
+				default :
+					return false;
+			}
+		}
+
+		static bool timeValue( Opcode opcode, const Context *context, Value &value )
+		{
+			const IECore::FloatData *frame = IECore::runTimeCast<const IECore::FloatData>( context->get<IECore::Data>( "frame", nullptr ) );
+			const IECore::FloatData *framesPerSecond = IECore::runTimeCast<const IECore::FloatData>( context->get<IECore::Data>( "framesPerSecond", nullptr ) );
+			switch( opcode )
+			{
+				case Frame :
+					if( !frame )
+					{
+						return false;
+					}
+					value = Value::floatingPoint( frame->readable() );
+					return true;
+				case FramesPerSecond :
+					if( !framesPerSecond )
+					{
+						return false;
+					}
+					value = Value::floatingPoint( framesPerSecond->readable() );
+					return true;
+				default :
+					if( !frame || !framesPerSecond )
+					{
+						return false;
+					}
+					// Matches `Context::getTime()`, which uses
+					// single precision.
+					value = Value::floatingPoint( frame->readable() / framesPerSecond->readable() );
+					return true;
+			}
+		}
+
+		static bool binaryOperation( Opcode opcode, const Value &a, const Value &b, Value &result )
+		{
+			if( a.type != Value::Float && b.type != Value::Float )
+			{
+				// Python 2 promotes to `long` on overflow, so we
+				// return false and let Python handle those cases.
+				int64_t i;
+				switch( opcode )
+				{
+					case Add :
+						if( __builtin_add_overflow( a.i, b.i, &i ) )
+						{
+							return false;
+						}
+						result = Value::integer( i );
+						return true;
+					case Subtract :
+						if( __builtin_sub_overflow( a.i, b.i, &i ) )
+						{
+							return false;
+						}
+						result = Value::integer( i );
+						return true;
+					case Multiply :
+						if( __builtin_mul_overflow( a.i, b.i, &i ) )
+						{
+							return false;
+						}
+						result = Value::integer( i );
+						return true;
+					default :
+					{
+						if( b.i == 0 || ( b.i == -1 && a.i == std::numeric_limits<int64_t>::min() ) )
+						{
+							return false;
+						}
+						// Python 2 integer division rounds towards
+						// negative infinity.
+						int64_t q = a.i / b.i;
+						if( ( a.i % b.i != 0 ) && ( ( a.i < 0 ) != ( b.i < 0 ) ) )
+						{
+							q--;
+						}
+						result = Value::integer( q );
+						return true;
+					}
+				}
+			}
+
+			const double x = a.asFloat();
+			const double y = b.asFloat();
+			switch( opcode )
+			{
+				case Add :
+					result = Value::floatingPoint( x + y );
+					return true;
+				case Subtract :
+					result = Value::floatingPoint( x - y );
+					return true;
+				case Multiply :
+					result = Value::floatingPoint( x * y );
+					return true;
+				default :
+					if( y == 0.0 )
+					{
+						return false;
+					}
+					result = Value::floatingPoint( x / y );
+					return true;
+			}
+		}
+
+		static IECore::ObjectPtr valueData( const Value &value )
+		{
+			switch( value.type )
+			{
+				case Value::Bool :
+					return new IECore::BoolData( value.i );
+				case Value::Int :
+					if( value.i < std::numeric_limits<int>::min() || value.i > std::numeric_limits<int>::max() )
+					{
+						// Would be a long in Python.
+						return nullptr;
+					}
+					return new IECore::IntData( value.i );
+				default :
+					return new IECore::DoubleData( value.f );
+			}
+		}
+
+		std::vector<Instruction> m_instructions;
+		size_t m_numOutputs;
+
+};
+
 class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 {
 	public :
@@ -117,6 +552,7 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 
 		void parse( Expression *node, const std::string &expression, std::vector<ValuePlug *> &inputs, std::vector<ValuePlug *> &outputs, std::vector<IECore::InternedString> &contextVariables ) override
 		{
+			m_nativeProgram.reset();
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -145,6 +581,14 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 
 		IECore::ConstObjectVectorPtr execute( const Context *context, const std::vector<const ValuePlug *> &proxyInputs ) const override
 		{
+			if( m_nativeProgram )
+			{
+				if( IECore::ConstObjectVectorPtr result = m_nativeProgram->evaluate( context, proxyInputs ) )
+				{
+					return result;
+				}
+			}
+
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -174,6 +618,11 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 
 		void apply( ValuePlug *proxyOutput, const ValuePlug *topLevelProxyOutput, const IECore::Object *value ) const override
 		{
+			if( m_nativeProgram && NativeProgram::apply( proxyOutput, topLevelProxyOutput, value ) )
+			{
+				return;
+			}
+
 			if( isSubclassed() )
 			{
 				IECorePython::ScopedGILLock gilLock;
@@ -292,6 +741,27 @@ class EngineWrapper : public IECorePython::RefCountedWrapper<Expression::Engine>
 			return boost::python::tuple( l );
 		}
 
+		// Called from `parse()` by engines which can provide a native
+		// translation of the expression. This is then used in preference
+		// to calling `execute()` and `apply()`, falling back to them when
+		// native evaluation isn't possible.
+		static void setNativeProgram( Expression::Engine &engine, object program, size_t numOutputs )
+		{
+			EngineWrapper &wrapper = dynamic_cast<EngineWrapper &>( engine );
+			if( program.is_none() )
+			{
+				wrapper.m_nativeProgram.reset();
+			}
+			else
+			{
+				wrapper.m_nativeProgram.reset( new NativeProgram( program, numOutputs ) );
+			}
+		}
+
+	private :
+
+		std::unique_ptr<NativeProgram> m_nativeProgram;
+
 };
 
 static tuple languages()
@@ -370,6 +840,7 @@ void GafferModule::bindExpression()
 		.def( init<>() )
 		.def( "registerEngine", &EngineWrapper::registerEngine ).staticmethod( "registerEngine" )
 		.def( "registeredEngines", &EngineWrapper::registeredEngines ).staticmethod( "registeredEngines" )
+		.def( "_setNativeProgram", &EngineWrapper::setNativeProgram )
 	;
 
 	SignalClass<Expression::ExpressionChangedSignal, DefaultSignalCaller<Expression::ExpressionChangedSignal>, ExpressionChangedSlotCaller >( "ExpressionChangedSignal" );
@@ -44,22 +44,36 @@
 
 #include "Gaffer/ApplicationRoot.h"
 #include "Gaffer/CompoundDataPlug.h"
+#include "Gaffer/CompoundNumericPlug.h"
 #include "Gaffer/Context.h"
+#include "Gaffer/Metadata.h"
+#include "Gaffer/NumericPlug.h"
 #include "Gaffer/ScriptNode.h"
 #include "Gaffer/StandardSet.h"
 #include "Gaffer/StringPlug.h"
+#include "Gaffer/TypedPlug.h"
 
 #include "IECorePython/ExceptionAlgo.h"
 #include "IECorePython/ScopedGILLock.h"
 #include "IECorePython/ScopedGILRelease.h"
 
 #include "IECore/MessageHandler.h"
+#include "IECore/SimpleTypedData.h"
 
 #include "boost/algorithm/string/replace.hpp"
 #include "boost/lexical_cast.hpp"
+#include "boost/python/suite/indexing/container_utils.hpp"
 #include "boost/regex.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace Gaffer;
 using namespace GafferBindings;
@@ -108,7 +122,7 @@ const std::string formattedErrorContext( int lineNumber, const std::string &cont
 // Execute the script one top level statement at a time,
 // reporting errors that occur, but otherwise continuing
 // with execution.
-bool tolerantExec( const char *pythonScript, boost::python::object globals, boost::python::object locals, const std::string &context )
+bool tolerantExec( const char *pythonScript, boost::python::object globals, boost::python::object locals, const std::string &context, int lineOffset = 0 )
 {
 	// The python parsing framework uses an arena to simplify memory allocation,
 	// which is handy for us, since we're going to manipulate the AST a little.
@@ -128,7 +142,7 @@ bool tolerantExec( const char *pythonScript, boost::python::object globals, boos
 	{
 		int lineNumber = 0;
 		std::string message = IECorePython::ExceptionAlgo::formatPythonException( /* withTraceback = */ false, &lineNumber );
-		IECore::msg( IECore::Msg::Error, formattedErrorContext( lineNumber, context ), message );
+		IECore::msg( IECore::Msg::Error, formattedErrorContext( lineNumber + lineOffset, context ), message );
 		return false;
 	}
 
@@ -165,7 +179,7 @@ bool tolerantExec( const char *pythonScript, boost::python::object globals, boos
 		{
 			int lineNumber = 0;
 			std::string message = IECorePython::ExceptionAlgo::formatPythonException( /* withTraceback = */ false, &lineNumber );
-			IECore::msg( IECore::Msg::Error, formattedErrorContext( lineNumber, context ), message );
+			IECore::msg( IECore::Msg::Error, formattedErrorContext( lineNumber + lineOffset, context ), message );
 			result = true;
 		}
 	}
@@ -197,6 +211,961 @@ boost::python::object executionDict( ScriptNodePtr script, NodePtr parent )
 	return std::move( result );
 }
 
+// Executes the script with python, either stopping at the first error
+// or continuing past errors as requested. The line offset is added to
+// the line numbers in error messages, for use when `pythonScript` is an
+// extract from a larger script.
+bool pythonExec( const char *pythonScript, boost::python::object globals, bool continueOnError, const std::string &context, int lineOffset = 0 )
+{
+	if( continueOnError )
+	{
+		return tolerantExec( pythonScript, globals, globals, context, lineOffset );
+	}
+
+	try
+	{
+		exec( pythonScript, globals, globals );
+	}
+	catch( boost::python::error_already_set &e )
+	{
+		int lineNumber = 0;
+		std::string message = IECorePython::ExceptionAlgo::formatPythonException( /* withTraceback = */ false, &lineNumber );
+		throw IECore::Exception( formattedErrorContext( lineNumber + lineOffset, context ) + " : " + message );
+	}
+
+	return false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Native execution
+//////////////////////////////////////////////////////////////////////////
+
+// The bulk of a typical serialisation consists of `setValue()`, `setInput()`
+// and `Metadata.registerValue()` statements, and interpreting these one by
+// one in python dominates the time taken to load large scripts. So we parse
+// the simplest forms of these statements ourselves and apply them directly,
+// passing everything else on to python. Any statement we don't recognise
+// exactly, or can't apply without error, is given to python instead, so
+// that behaviour and error reporting are unchanged.
+
+// A top level statement, as a range of characters within the script.
+struct Statement
+{
+	const char *begin;
+	const char *end;
+	int line;
+};
+
+// Splits the script into top level statements, taking into account
+// brackets, strings, comments and line continuations. This needn't be a
+// complete tokeniser, as it just needs to find statement boundaries in
+// valid python. Returns false if the script isn't understood, in which
+// case it should be given to python in its entirety.
+bool splitStatements( const std::string &script, std::vector<Statement> &statements )
+{
+	const char *c = script.c_str();
+	const char *end = c + script.size();
+
+	int line = 1;
+	int depth = 0;
+	Statement current = { c, c, line };
+	while( c < end )
+	{
+		switch( *c )
+		{
+			case '#' :
+				while( c < end && *c != '\n' )
+				{
+					c++;
+				}
+				continue;
+			case '\'' :
+			case '"' :
+			{
+				const char quote = *c;
+				const bool triple = end - c >= 3 && c[1] == quote && c[2] == quote;
+				c += triple ? 3 : 1;
+				while( true )
+				{
+					if( c >= end )
+					{
+						return false;
+					}
+					else if( *c == '\\' )
+					{
+						if( c + 1 < end && c[1] == '\n' )
+						{
+							line++;
+						}
+						c += 2;
+					}
+					else if( *c == '\n' )
+					{
+						if( !triple )
+						{
+							return false;
+						}
+						line++;
+						c++;
+					}
+					else if( *c == quote && ( !triple || ( end - c >= 3 && c[1] == quote && c[2] == quote ) ) )
+					{
+						c += triple ? 3 : 1;
+						break;
+					}
+					else
+					{
+						c++;
+					}
+				}
+				continue;
+			}
+			case '(' :
+			case '[' :
+			case '{' :
+				depth++;
+				break;
+			case ')' :
+			case ']' :
+			case '}' :
+				depth--;
+				break;
+			case '\\' :
+				if( c + 1 < end && c[1] == '\n' )
+				{
+					line++;
+					c += 2;
+					continue;
+				}
+				break;
+			case '\n' :
+				line++;
+				if( depth == 0 )
+				{
+					current.end = c + 1;
+					statements.push_back( current );
+					current.begin = c + 1;
+					current.line = line;
+				}
+				break;
+		}
+		c++;
+	}
+
+	if( current.begin < end )
+	{
+		current.end = end;
+		statements.push_back( current );
+	}
+
+	return depth == 0;
+}
+
+bool isBlank( const Statement &statement )
+{
+	for( const char *c = statement.begin; c < statement.end; ++c )
+	{
+		switch( *c )
+		{
+			case ' ' :
+			case '\t' :
+			case '\r' :
+			case '\n' :
+				break;
+			case '#' :
+				return true;
+			default :
+				return false;
+		}
+	}
+	return true;
+}
+
+// A literal value, as serialised by `repr()`.
+struct Literal
+{
+
+	enum Type
+	{
+		Bool,
+		Int,
+		Float,
+		String,
+		V2f,
+		V3f,
+		V2i,
+		V3i,
+		Color3f,
+		Color4f
+	};
+
+	Type type;
+	bool b;
+	long i;
+	double f[4];
+	std::string s;
+
+};
+
+// A reference to a node or plug, of the form `parent["a"]["b"]` or
+// `__children["n"]["a"]["b"]`.
+struct GraphComponentPath
+{
+	std::string root;
+	std::vector<IECore::InternedString> names;
+};
+
+struct NativeStatement
+{
+
+	enum Type
+	{
+		SetValue,
+		SetInput,
+		RegisterValue
+	};
+
+	Type type;
+	GraphComponentPath target;
+	GraphComponentPath input;
+	std::string key;
+	Literal value;
+
+};
+
+// Recursive descent parser for NativeStatements. Each method
+// returns false without consuming anything significant if the
+// input doesn't match.
+class NativeStatementParser
+{
+
+	public :
+
+		NativeStatementParser( const char *begin, const char *end )
+			:	m_c( begin ), m_end( end )
+		{
+		}
+
+		bool parse( NativeStatement &statement )
+		{
+			if( m_c == m_end || *m_c == ' ' || *m_c == '\t' )
+			{
+				// Indented statements belong to a compound
+				// statement, which python must execute.
+				return false;
+			}
+
+			if( identifier( "Gaffer" ) )
+			{
+				statement.type = NativeStatement::RegisterValue;
+				if( !(
+					character( '.' ) && identifier( "Metadata" ) &&
+					character( '.' ) && identifier( "registerValue" ) &&
+					character( '(' ) && graphComponentPath( statement.target ) &&
+					character( ',' ) && stringLiteral( statement.key ) &&
+					character( ',' ) && literal( statement.value ) &&
+					character( ')' )
+				) )
+				{
+					return false;
+				}
+				if( statement.value.type == Literal::Int || statement.value.type == Literal::Float )
+				{
+					// The python bindings have their own rules for
+					// converting numbers to Data, so we leave them
+					// to it.
+					return false;
+				}
+			}
+			else
+			{
+				if( !graphComponentPath( statement.target ) || !character( '.' ) )
+				{
+					return false;
+				}
+
+				if( identifier( "setValue" ) )
+				{
+					statement.type = NativeStatement::SetValue;
+					if( !( character( '(' ) && literal( statement.value ) && character( ')' ) ) )
+					{
+						return false;
+					}
+				}
+				else if( identifier( "setInput" ) )
+				{
+					statement.type = NativeStatement::SetInput;
+					if( !( character( '(' ) && graphComponentPath( statement.input ) && character( ')' ) ) )
+					{
+						return false;
+					}
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			skipWhitespace();
+			// Allow a trailing comment. This must extend to the end of
+			// the statement, because splitStatements() ends statements
+			// at the first unbracketed newline.
+			return m_c == m_end || *m_c == '#';
+		}
+
+	private :
+
+		void skipWhitespace()
+		{
+			while( m_c < m_end && ( *m_c == ' ' || *m_c == '\t' || *m_c == '\r' || *m_c == '\n' ) )
+			{
+				m_c++;
+			}
+		}
+
+		static bool isIdentifierCharacter( char c )
+		{
+			return isalnum( (unsigned char)c ) || c == '_';
+		}
+
+		bool character( char c )
+		{
+			skipWhitespace();
+			if( m_c < m_end && *m_c == c )
+			{
+				m_c++;
+				return true;
+			}
+			return false;
+		}
+
+		bool identifier( const char *word )
+		{
+			skipWhitespace();
+			const size_t length = strlen( word );
+			if( (size_t)( m_end - m_c ) < length || strncmp( m_c, word, length ) )
+			{
+				return false;
+			}
+			if( m_c + length < m_end && isIdentifierCharacter( m_c[length] ) )
+			{
+				return false;
+			}
+			m_c += length;
+			return true;
+		}
+
+		bool stringLiteral( std::string &result )
+		{
+			skipWhitespace();
+			if( m_c == m_end || ( *m_c != '\'' && *m_c != '"' ) )
+			{
+				return false;
+			}
+
+			const char quote = *m_c++;
+			result.clear();
+			while( m_c < m_end )
+			{
+				const char c = *m_c++;
+				if( c == quote )
+				{
+					// Reject triple quoted strings and implicit
+					// concatenation.
+					return result.size() || m_c == m_end || *m_c != quote;
+				}
+				else if( c == '\n' )
+				{
+					return false;
+				}
+				else if( c != '\\' )
+				{
+					result.push_back( c );
+					continue;
+				}
+
+				if( m_c == m_end )
+				{
+					return false;
+				}
+				switch( *m_c++ )
+				{
+					case '\\' : result.push_back( '\\' ); break;
+					case '\'' : result.push_back( '\'' ); break;
+					case '"' : result.push_back( '"' ); break;
+					case 'n' : result.push_back( '\n' ); break;
+					case 'r' : result.push_back( '\r' ); break;
+					case 't' : result.push_back( '\t' ); break;
+					case 'x' :
+					{
+						if( m_end - m_c < 2 || !isxdigit( (unsigned char)m_c[0] ) || !isxdigit( (unsigned char)m_c[1] ) )
+						{
+							return false;
+						}
+						const char hex[3] = { m_c[0], m_c[1], 0 };
+						result.push_back( (char)strtol( hex, nullptr, 16 ) );
+						m_c += 2;
+						break;
+					}
+					default :
+						// Other escapes are rare enough to
+						// leave to python.
+						return false;
+				}
+			}
+			return false;
+		}
+
+		bool number( double &d, long &i, bool &isInt )
+		{
+			skipWhitespace();
+			const char *c = m_c;
+			if( c < m_end && *c == '-' )
+			{
+				c++;
+			}
+			if( c == m_end || !isdigit( (unsigned char)*c ) )
+			{
+				// Excludes `inf`, `nan` and the like.
+				return false;
+			}
+
+			const char *numberEnd = c;
+			isInt = true;
+			while( numberEnd < m_end && ( isdigit( (unsigned char)*numberEnd ) || *numberEnd == '.' || *numberEnd == 'e' || *numberEnd == 'E' || ( ( *numberEnd == '-' || *numberEnd == '+' ) && ( numberEnd[-1] == 'e' || numberEnd[-1] == 'E' ) ) ) )
+			{
+				if( !isdigit( (unsigned char)*numberEnd ) )
+				{
+					isInt = false;
+				}
+				numberEnd++;
+			}
+			if( numberEnd < m_end && isIdentifierCharacter( *numberEnd ) )
+			{
+				// Python 2 longs, hex, and other things we
+				// don't want to deal with.
+				return false;
+			}
+
+			const std::string text( m_c, numberEnd );
+			char *parsedEnd = nullptr;
+			errno = 0;
+			if( isInt )
+			{
+				i = strtol( text.c_str(), &parsedEnd, 10 );
+				if( errno || i < std::numeric_limits<int>::min() || i > std::numeric_limits<int>::max() )
+				{
+					return false;
+				}
+				d = i;
+			}
+			else
+			{
+				d = strtod( text.c_str(), &parsedEnd );
+				if( errno )
+				{
+					return false;
+				}
+			}
+
+			if( parsedEnd != text.c_str() + text.size() )
+			{
+				return false;
+			}
+
+			m_c = numberEnd;
+			return true;
+		}
+
+		bool numbers( double *d, int count, bool integer )
+		{
+			for( int n = 0; n < count; ++n )
+			{
+				long i; bool isInt;
+				if( ( n && !character( ',' ) ) || !number( d[n], i, isInt ) || ( integer && !isInt ) )
+				{
+					return false;
+				}
+			}
+			return character( ')' );
+		}
+
+		bool literal( Literal &value )
+		{
+			if( identifier( "True" ) )
+			{
+				value.type = Literal::Bool;
+				value.b = true;
+				return true;
+			}
+			else if( identifier( "False" ) )
+			{
+				value.type = Literal::Bool;
+				value.b = false;
+				return true;
+			}
+			else if( stringLiteral( value.s ) )
+			{
+				value.type = Literal::String;
+				return true;
+			}
+			else if( identifier( "imath" ) )
+			{
+				if( !character( '.' ) )
+				{
+					return false;
+				}
+
+				static const struct { const char *name; Literal::Type type; int size; bool integer; } g_types[] = {
+					{ "V2f", Literal::V2f, 2, false },
+					{ "V3f", Literal::V3f, 3, false },
+					{ "V2i", Literal::V2i, 2, true },
+					{ "V3i", Literal::V3i, 3, true },
+					{ "Color3f", Literal::Color3f, 3, false },
+					{ "Color4f", Literal::Color4f, 4, false }
+				};
+
+				for( const auto &t : g_types )
+				{
+					if( identifier( t.name ) )
+					{
+						value.type = t.type;
+						return character( '(' ) && numbers( value.f, t.size, t.integer );
+					}
+				}
+				return false;
+			}
+
+			bool isInt = false;
+			if( number( value.f[0], value.i, isInt ) )
+			{
+				value.type = isInt ? Literal::Int : Literal::Float;
+				return true;
+			}
+
+			return false;
+		}
+
+		bool graphComponentPath( GraphComponentPath &path )
+		{
+			if( identifier( "parent" ) )
+			{
+				path.root = "parent";
+			}
+			else if( identifier( "__children" ) )
+			{
+				std::string name;
+				if( !( character( '[' ) && stringLiteral( name ) && character( ']' ) ) )
+				{
+					return false;
+				}
+				path.root = name;
+			}
+			else
+			{
+				return false;
+			}
+
+			path.names.clear();
+			while( character( '[' ) )
+			{
+				std::string name;
+				if( !( stringLiteral( name ) && character( ']' ) ) )
+				{
+					return false;
+				}
+				path.names.push_back( name );
+			}
+
+			return true;
+		}
+
+		const char *m_c;
+		const char *m_end;
+
+};
+
+GraphComponent *resolve( const GraphComponentPath &path, boost::python::object &globals )
+{
+	PyObject *rootObject = nullptr;
+	if( path.root == "parent" )
+	{
+		rootObject = PyDict_GetItemString( globals.ptr(), "parent" );
+	}
+	else
+	{
+		PyObject *children = PyDict_GetItemString( globals.ptr(), "__children" );
+		if( children && PyDict_Check( children ) )
+		{
+			rootObject = PyDict_GetItemString( children, path.root.c_str() );
+		}
+	}
+
+	if( !rootObject )
+	{
+		return nullptr;
+	}
+
+	boost::python::extract<GraphComponent *> rootExtractor( rootObject );
+	if( !rootExtractor.check() )
+	{
+		return nullptr;
+	}
+
+	GraphComponent *result = rootExtractor();
+	for( const auto &name : path.names )
+	{
+		result = result ? result->getChild( name ) : nullptr;
+	}
+
+	return result;
+}
+
+template<typename PlugType, typename ValueType>
+void setPlugValue( Plug *plug, const ValueType &value )
+{
+	// We release the GIL as the python bindings do, in case a slot
+	// triggers a computation which needs python on another thread.
+	IECorePython::ScopedGILRelease gilRelease;
+	static_cast<PlugType *>( plug )->setValue( value );
+}
+
+// Returns false if the plug isn't of a type we know how to set from
+// the literal, in which case python must do the work.
+bool setValue( Plug *plug, const Literal &value )
+{
+	const IECore::TypeId plugType = plug->typeId();
+	const double *f = value.f;
+	if( plugType == BoolPlug::staticTypeId() && value.type == Literal::Bool )
+	{
+		setPlugValue<BoolPlug>( plug, value.b );
+	}
+	else if( plugType == IntPlug::staticTypeId() && value.type == Literal::Int )
+	{
+		setPlugValue<IntPlug>( plug, (int)value.i );
+	}
+	else if( plugType == FloatPlug::staticTypeId() && ( value.type == Literal::Float || value.type == Literal::Int ) )
+	{
+		setPlugValue<FloatPlug>( plug, (float)f[0] );
+	}
+	else if( plugType == StringPlug::staticTypeId() && value.type == Literal::String )
+	{
+		setPlugValue<StringPlug>( plug, value.s );
+	}
+	else if( plugType == V2fPlug::staticTypeId() && value.type == Literal::V2f )
+	{
+		setPlugValue<V2fPlug>( plug, Imath::V2f( f[0], f[1] ) );
+	}
+	else if( plugType == V3fPlug::staticTypeId() && value.type == Literal::V3f )
+	{
+		setPlugValue<V3fPlug>( plug, Imath::V3f( f[0], f[1], f[2] ) );
+	}
+	else if( plugType == V2iPlug::staticTypeId() && value.type == Literal::V2i )
+	{
+		setPlugValue<V2iPlug>( plug, Imath::V2i( (int)f[0], (int)f[1] ) );
+	}
+	else if( plugType == V3iPlug::staticTypeId() && value.type == Literal::V3i )
+	{
+		setPlugValue<V3iPlug>( plug, Imath::V3i( (int)f[0], (int)f[1], (int)f[2] ) );
+	}
+	else if( plugType == Color3fPlug::staticTypeId() && value.type == Literal::Color3f )
+	{
+		setPlugValue<Color3fPlug>( plug, Imath::Color3f( f[0], f[1], f[2] ) );
+	}
+	else if( plugType == Color4fPlug::staticTypeId() && value.type == Literal::Color4f )
+	{
+		setPlugValue<Color4fPlug>( plug, Imath::Color4f( f[0], f[1], f[2], f[3] ) );
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+// Returns false if the statement must be executed by python instead.
+bool applyNativeStatement( const NativeStatement &statement, boost::python::object &globals )
+{
+	GraphComponent *target = resolve( statement.target, globals );
+	Plug *plug = IECore::runTimeCast<Plug>( target );
+	if( !plug && statement.type != NativeStatement::RegisterValue )
+	{
+		return false;
+	}
+
+	switch( statement.type )
+	{
+		case NativeStatement::SetValue :
+		{
+			const ValuePlug *valuePlug = IECore::runTimeCast<ValuePlug>( plug );
+			if( !valuePlug || !valuePlug->settable() )
+			{
+				// Leave python to report the error.
+				return false;
+			}
+			return setValue( plug, statement.value );
+		}
+		case NativeStatement::SetInput :
+		{
+			Plug *input = IECore::runTimeCast<Plug>( resolve( statement.input, globals ) );
+			if( !input || !plug->acceptsInput( input ) )
+			{
+				return false;
+			}
+			IECorePython::ScopedGILRelease gilRelease;
+			plug->setInput( input );
+			return true;
+		}
+		case NativeStatement::RegisterValue :
+		{
+			if( !target )
+			{
+				return false;
+			}
+			const Literal &l = statement.value;
+			IECore::ConstDataPtr value;
+			switch( l.type )
+			{
+				case Literal::Bool : value = new IECore::BoolData( l.b ); break;
+				case Literal::String : value = new IECore::StringData( l.s ); break;
+				case Literal::V2f : value = new IECore::V2fData( Imath::V2f( l.f[0], l.f[1] ) ); break;
+				case Literal::V3f : value = new IECore::V3fData( Imath::V3f( l.f[0], l.f[1], l.f[2] ) ); break;
+				case Literal::V2i : value = new IECore::V2iData( Imath::V2i( (int)l.f[0], (int)l.f[1] ) ); break;
+				case Literal::V3i : value = new IECore::V3iData( Imath::V3i( (int)l.f[0], (int)l.f[1], (int)l.f[2] ) ); break;
+				case Literal::Color3f : value = new IECore::Color3fData( Imath::Color3f( l.f[0], l.f[1], l.f[2] ) ); break;
+				case Literal::Color4f : value = new IECore::Color4fData( Imath::Color4f( l.f[0], l.f[1], l.f[2], l.f[3] ) ); break;
+				default : return false;
+			}
+			IECorePython::ScopedGILRelease gilRelease;
+			Metadata::registerValue( target, statement.key, value );
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool nativeExecutionEnabled()
+{
+	const char *e = getenv( "GAFFER_NATIVE_SCRIPT_EXECUTION" );
+	return !e || strcmp( e, "0" );
+}
+
+// Executes the script, applying native statements directly and passing
+// runs of all other statements to python.
+bool nativeExec( const std::string &script, boost::python::object globals, bool continueOnError, const std::string &context )
+{
+	std::vector<Statement> statements;
+	if( !splitStatements( script, statements ) )
+	{
+		return pythonExec( script.c_str(), globals, continueOnError, context );
+	}
+
+	bool result = false;
+	const Statement *pythonBegin = nullptr;
+	auto flushPython = [&]( const char *pythonEnd ) {
+		if( pythonBegin )
+		{
+			const std::string pythonScript( pythonBegin->begin, pythonEnd );
+			result = pythonExec( pythonScript.c_str(), globals, continueOnError, context, pythonBegin->line - 1 ) || result;
+			pythonBegin = nullptr;
+		}
+	};
+
+	NativeStatement nativeStatement;
+	for( const auto &statement : statements )
+	{
+		if( NativeStatementParser( statement.begin, statement.end ).parse( nativeStatement ) )
+		{
+			flushPython( statement.begin );
+			try
+			{
+				if( applyNativeStatement( nativeStatement, globals ) )
+				{
+					continue;
+				}
+			}
+			catch( const std::exception &e )
+			{
+				const std::string errorContext = formattedErrorContext( statement.line, context );
+				if( !continueOnError )
+				{
+					throw IECore::Exception( errorContext + " : " + e.what() );
+				}
+				IECore::msg( IECore::Msg::Error, errorContext, e.what() );
+				result = true;
+				continue;
+			}
+		}
+		else if( !pythonBegin && isBlank( statement ) )
+		{
+			continue;
+		}
+
+		if( !pythonBegin )
+		{
+			pythonBegin = &statement;
+		}
+	}
+
+	flushPython( script.c_str() + script.size() );
+	return result;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Partial loading
+//////////////////////////////////////////////////////////////////////////
+
+// Finds the names of top level nodes referred to in a statement, either
+// via the `__children` dictionary or via `parent` (the latter being the
+// form used by expressions). We search the raw text, including the
+// contents of strings, because it is better to load a node unnecessarily
+// than to miss one that is needed. The owner is the first node referred
+// to via `__children` - this is the node the statement is operating on.
+void nodeReferences( const Statement &statement, std::string &owner, std::vector<std::string> &references )
+{
+	static const std::string g_children = "__children[";
+	static const std::string g_parent = "parent[";
+
+	owner.clear();
+	references.clear();
+
+	for( const char *c = statement.begin; c < statement.end; ++c )
+	{
+		size_t prefixLength;
+		bool children;
+		if( (size_t)( statement.end - c ) > g_children.size() && !strncmp( c, g_children.c_str(), g_children.size() ) )
+		{
+			prefixLength = g_children.size();
+			children = true;
+		}
+		else if( (size_t)( statement.end - c ) > g_parent.size() && !strncmp( c, g_parent.c_str(), g_parent.size() ) )
+		{
+			prefixLength = g_parent.size();
+			children = false;
+		}
+		else
+		{
+			continue;
+		}
+
+		const char *nameBegin = c + prefixLength;
+		while( nameBegin < statement.end && ( *nameBegin == ' ' || *nameBegin == '\\' ) )
+		{
+			nameBegin++;
+		}
+		if( nameBegin == statement.end || ( *nameBegin != '"' && *nameBegin != '\'' ) )
+		{
+			continue;
+		}
+		const char quote = *nameBegin++;
+		const char *nameEnd = nameBegin;
+		while( nameEnd < statement.end && *nameEnd != quote && *nameEnd != '\\' )
+		{
+			nameEnd++;
+		}
+		if( nameEnd == statement.end )
+		{
+			continue;
+		}
+
+		references.push_back( std::string( nameBegin, nameEnd ) );
+		if( children && owner.empty() )
+		{
+			owner = references.back();
+		}
+		c = nameEnd;
+	}
+}
+
+// Returns a version of the serialisation containing only the statements
+// needed to load the named top level nodes and the nodes they depend on.
+// Skipped statements are replaced with blank lines, so that line numbers
+// in error messages still refer to the original file.
+std::string filter( const std::string &serialisation, const std::vector<std::string> &nodeNames )
+{
+	std::vector<Statement> statements;
+	if( !splitStatements( serialisation, statements ) )
+	{
+		// Let execution report the problem.
+		return serialisation;
+	}
+
+	// Index the statements by the node they belong to, and
+	// record the dependencies between nodes.
+
+	typedef std::unordered_map<std::string, std::unordered_set<std::string>> Dependencies;
+	Dependencies dependencies;
+	std::vector<std::string> owners;
+	owners.reserve( statements.size() );
+
+	std::unordered_set<std::string> required;
+	std::vector<std::string> toVisit;
+	for( const auto &name : nodeNames )
+	{
+		// Descendants can only be loaded by loading their
+		// top level ancestor.
+		toVisit.push_back( name.substr( 0, name.find( '.' ) ) );
+	}
+
+	std::string owner;
+	std::vector<std::string> references;
+	for( const auto &statement : statements )
+	{
+		nodeReferences( statement, owner, references );
+		owners.push_back( owner );
+		for( const auto &reference : references )
+		{
+			if( owner.empty() )
+			{
+				// Global statements are always executed, so
+				// anything they refer to is required.
+				toVisit.push_back( reference );
+			}
+			else if( reference != owner )
+			{
+				dependencies[owner].insert( reference );
+			}
+		}
+	}
+
+	// Find everything that is required.
+
+	while( !toVisit.empty() )
+	{
+		const std::string name = toVisit.back();
+		toVisit.pop_back();
+		if( !required.insert( name ).second )
+		{
+			continue;
+		}
+		auto it = dependencies.find( name );
+		if( it != dependencies.end() )
+		{
+			toVisit.insert( toVisit.end(), it->second.begin(), it->second.end() );
+		}
+	}
+
+	// Build the filtered serialisation.
+
+	std::string result;
+	result.reserve( serialisation.size() );
+	for( size_t i = 0, e = statements.size(); i < e; ++i )
+	{
+		const Statement &statement = statements[i];
+		if( owners[i].empty() || required.count( owners[i] ) )
+		{
+			result.append( statement.begin, statement.end );
+		}
+		else
+		{
+			result.append( std::count( statement.begin, statement.end, '\n' ), '\n' );
+		}
+	}
+
+	return result;
+}
+
 std::string serialise( const Node *parent, const Set *filter )
 {
 	if( !Py_IsInitialized() )
@@ -285,22 +1254,13 @@ bool execute( ScriptNode *script, const std::string &serialisation, Node *parent
 	{
 		boost::python::object e = executionDict( script, parent );
 
-		if( !continueOnError )
+		if( nativeExecutionEnabled() )
 		{
-			try
-			{
-				exec( toExecute.c_str(), e, e );
-			}
-			catch( boost::python::error_already_set &e )
-			{
-				int lineNumber = 0;
-				std::string message = IECorePython::ExceptionAlgo::formatPythonException( /* withTraceback = */ false, &lineNumber );
-				throw IECore::Exception( formattedErrorContext( lineNumber, context ) + " : " + message );
-			}
+			result = nativeExec( toExecute, e, continueOnError, context );
 		}
 		else
 		{
-			result = tolerantExec( toExecute.c_str(), e, e, context );
+			result = pythonExec( toExecute.c_str(), e, continueOnError, context );
 		}
 	}
 	catch( boost::python::error_already_set &e )
@@ -322,6 +1282,7 @@ struct SerialiserRegistration
 	{
 		ScriptNode::g_serialiseFunction = serialise;
 		ScriptNode::g_executeFunction = execute;
+		ScriptNode::g_filterFunction = filter;
 	}
 };
 
@@ -426,6 +1387,14 @@ bool load( ScriptNode &s, bool continueOnError )
 	return s.load( continueOnError );
 }
 
+bool loadNodes( ScriptNode &s, boost::python::list nodes, bool continueOnError )
+{
+	std::vector<std::string> nodeNames;
+	boost::python::container_utils::extend_container( nodeNames, nodes );
+	IECorePython::ScopedGILRelease r;
+	return s.load( nodeNames, continueOnError );
+}
+
 void save( ScriptNode &s )
 {
 	IECorePython::ScopedGILRelease r;
@@ -499,6 +1468,7 @@ void GafferModule::bindScriptNode()
 		.def( "serialiseToFile", &ScriptNode::serialiseToFile, ( boost::python::arg( "fileName" ), boost::python::arg( "parent" ) = boost::python::object(), boost::python::arg( "filter" ) = boost::python::object() ) )
 		.def( "save", &save )
 		.def( "load", &load, ( boost::python::arg( "continueOnError" ) = false ) )
+		.def( "load", &loadNodes, ( boost::python::arg( "nodes" ), boost::python::arg( "continueOnError" ) = false ) )
 		.def( "importFile", &importFile, ( boost::python::arg( "fileName" ), boost::python::arg( "parent" ) = boost::python::object(), boost::python::arg( "continueOnError" ) = false ) )
 		.def( "context", &context )
 	;
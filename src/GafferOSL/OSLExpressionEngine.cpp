@@ -53,6 +53,7 @@
 
 #include "boost/algorithm/string/replace.hpp"
 #include "boost/lexical_cast.hpp"
+#include "boost/noncopyable.hpp"
 #include "boost/regex.hpp"
 
 using namespace std;
@@ -318,9 +319,10 @@ class OSLExpressionEngine : public Gaffer::Expression::Engine
 		IECore::ConstObjectVectorPtr execute( const Gaffer::Context *context, const std::vector<const Gaffer::ValuePlug *> &proxyInputs ) const override
 		{
 			ShadingSystem *s = shadingSystem();
-			OSL::ShadingContext *shadingContext = s->get_context();
+			ShadingContextScope shadingContextScope( s );
+			OSL::ShadingContext *shadingContext = shadingContextScope.shadingContext();
 
-		    OSL::ShaderGlobals shaderGlobals;
+			OSL::ShaderGlobals shaderGlobals;
 			memset( &shaderGlobals, 0, sizeof( ShaderGlobals ) );
 
 			shaderGlobals.time = context->getTime();
@@ -374,7 +376,6 @@ class OSLExpressionEngine : public Gaffer::Expression::Engine
 				}
 			}
 
-			s->release_context( shadingContext );
 			return result;
 		}
 
@@ -572,6 +573,35 @@ class OSLExpressionEngine : public Gaffer::Expression::Engine
 			return g_s;
 		};
 
+		// Acquires a ShadingContext for the duration of an execution,
+		// releasing it even if execution throws.
+		class ShadingContextScope : boost::noncopyable
+		{
+
+			public :
+
+				ShadingContextScope( OSL::ShadingSystem *shadingSystem )
+					:	m_shadingSystem( shadingSystem ), m_shadingContext( shadingSystem->get_context() )
+				{
+				}
+
+				~ShadingContextScope()
+				{
+					m_shadingSystem->release_context( m_shadingContext );
+				}
+
+				OSL::ShadingContext *shadingContext() const
+				{
+					return m_shadingContext;
+				}
+
+			private :
+
+				OSL::ShadingSystem *m_shadingSystem;
+				OSL::ShadingContext *m_shadingContext;
+
+		};
+
 		static void findPlugPaths( const string &expression, vector<string> &inPaths, vector<string> &outPaths )
 		{
 			set<string> visited;
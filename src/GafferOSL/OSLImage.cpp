@@ -44,6 +44,9 @@
 #include "Gaffer/StringPlug.h"
 
 #include "IECore/CompoundData.h"
+#include "IECore/VectorTypedData.h"
+
+#include "tbb/enumerable_thread_specific.h"
 
 using namespace std;
 using namespace Imath;
@@ -52,6 +55,42 @@ using namespace Gaffer;
 using namespace GafferImage;
 using namespace GafferOSL;
 
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// The P, u and v shading points have the same size for every tile,
+// so rather than allocate them afresh for every compute, we reuse
+// them from a per-thread pool.
+struct ShadingPointBuffers
+{
+	V3fVectorDataPtr p;
+	FloatVectorDataPtr u;
+	FloatVectorDataPtr v;
+};
+
+tbb::enumerable_thread_specific<ShadingPointBuffers> g_shadingPointBuffers;
+
+template<typename T>
+typename T::ValueType &reusableBuffer( IECore::IntrusivePtr<T> &data, size_t size )
+{
+	// If the buffer is still referenced from elsewhere (for instance by
+	// a reentrant compute on this thread) then we can't reuse it, and
+	// must replace it with a new one.
+	if( !data || data->refCount() > 1 )
+	{
+		data = new T;
+	}
+	typename T::ValueType &result = data->writable();
+	result.resize( size );
+	return result;
+}
+
+} // namespace
+
 IE_CORE_DEFINERUNTIMETYPED( OSLImage );
 
 size_t OSLImage::g_firstPlugIndex = 0;
@@ -306,18 +345,12 @@ IECore::ConstCompoundDataPtr OSLImage::computeShading( const Gaffer::Context *co
 
 	CompoundDataPtr shadingPoints = new CompoundData();
 
-	V3fVectorDataPtr pData = new V3fVectorData;
-	FloatVectorDataPtr uData = new FloatVectorData;
-	FloatVectorDataPtr vData = new FloatVectorData;
-
-	vector<V3f> &pWritable = pData->writable();
-	vector<float> &uWritable = uData->writable();
-	vector<float> &vWritable = vData->writable();
-
+	ShadingPointBuffers &buffers = g_shadingPointBuffers.local();
 	const size_t tileSize = ImagePlug::tileSize();
-	pWritable.reserve( tileSize * tileSize );
-	uWritable.reserve( tileSize * tileSize );
-	vWritable.reserve( tileSize * tileSize );
+
+	vector<V3f> &pWritable = reusableBuffer( buffers.p, tileSize * tileSize );
+	vector<float> &uWritable = reusableBuffer( buffers.u, tileSize * tileSize );
+	vector<float> &vWritable = reusableBuffer( buffers.v, tileSize * tileSize );
 
 	const V2f uvStep = V2f( 1.0f ) / format.getDisplayWindow().size();
 	// UV value for the pixel at 0,0
@@ -325,20 +358,21 @@ IECore::ConstCompoundDataPtr OSLImage::computeShading( const Gaffer::Context *co
 
 	const V2i pMax = tileOrigin + V2i( tileSize );
 	V2i p;
+	size_t i = 0;
 	for( p.y = tileOrigin.y; p.y < pMax.y; ++p.y )
 	{
 		const float v = uvOrigin.y + p.y * uvStep.y;
-		for( p.x = tileOrigin.x; p.x < pMax.x; ++p.x )
+		for( p.x = tileOrigin.x; p.x < pMax.x; ++p.x, ++i )
 		{
-			uWritable.push_back( uvOrigin.x + p.x * uvStep.x );
-			vWritable.push_back( v );
-			pWritable.push_back( V3f( p.x + 0.5f, p.y + 0.5f, 0.0f ) );
+			uWritable[i] = uvOrigin.x + p.x * uvStep.x;
+			vWritable[i] = v;
+			pWritable[i] = V3f( p.x + 0.5f, p.y + 0.5f, 0.0f );
 		}
 	}
 
-	shadingPoints->writable()["P"] = pData;
-	shadingPoints->writable()["u"] = uData;
-	shadingPoints->writable()["v"] = vData;
+	shadingPoints->writable()["P"] = buffers.p;
+	shadingPoints->writable()["u"] = buffers.u;
+	shadingPoints->writable()["v"] = buffers.v;
 
 	{
 		ImagePlug::ChannelDataScope c( context );
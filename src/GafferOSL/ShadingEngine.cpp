@@ -687,8 +687,29 @@ class ShadingResults
 
 		typedef container::flat_map<ustring, DebugResult, OIIO::ustringPtrIsLess> DebugResultsMap;
 
-		void addResult( size_t pointIndex, const ClosureColor *result, DebugResultsMap &threadCache )
+		// Per-thread cache of results, to avoid locking when
+		// looking them up.
+		struct ThreadCache
 		{
+
+			ThreadCache()
+				:	sequenceIndex( 0 )
+			{
+			}
+
+			DebugResultsMap debugResults;
+			// Shaders typically output the same debug closures in the
+			// same order for every point. We record the sequence output
+			// for the previous point, so that for subsequent points each
+			// result can be found by index without searching `debugResults`.
+			vector<pair<ustring, DebugResult>> sequence;
+			size_t sequenceIndex;
+
+		};
+
+		void addResult( size_t pointIndex, const ClosureColor *result, ThreadCache &threadCache )
+		{
+			threadCache.sequenceIndex = 0;
 			addResult( pointIndex, result, Color3f( 1.0f ), threadCache );
 		}
 
@@ -699,7 +720,7 @@ class ShadingResults
 
 	private :
 
-		void addResult( size_t pointIndex, const ClosureColor *closure, const Color3f &weight, DebugResultsMap &threadCache )
+		void addResult( size_t pointIndex, const ClosureColor *closure, const Color3f &weight, ThreadCache &threadCache )
 		{
 			if( closure )
 			{
@@ -732,11 +753,34 @@ class ShadingResults
 			(*m_ci)[pointIndex] += weight;
 		}
 
-		DebugResult acquireDebugResult( const DebugParameters *parameters, DebugResultsMap &threadCache )
+		DebugResult acquireDebugResult( const DebugParameters *parameters, ThreadCache &threadCache )
+		{
+			// Try the sequence from the previous point first, as this
+			// is just a comparison of ustring pointers.
+			const size_t sequenceIndex = threadCache.sequenceIndex++;
+			if( sequenceIndex < threadCache.sequence.size() && threadCache.sequence[sequenceIndex].first == parameters->name )
+			{
+				return threadCache.sequence[sequenceIndex].second;
+			}
+
+			const DebugResult result = lookupDebugResult( parameters, threadCache );
+			if( sequenceIndex < threadCache.sequence.size() )
+			{
+				threadCache.sequence[sequenceIndex] = make_pair( parameters->name, result );
+			}
+			else
+			{
+				threadCache.sequence.push_back( make_pair( parameters->name, result ) );
+			}
+
+			return result;
+		}
+
+		DebugResult lookupDebugResult( const DebugParameters *parameters, ThreadCache &threadCache )
 		{
 			// Try the per-thread cache first.
-			auto it = threadCache.find( parameters->name );
-			if( it != threadCache.end() )
+			auto it = threadCache.debugResults.find( parameters->name );
+			if( it != threadCache.debugResults.end() )
 			{
 				return it->second;
 			}
@@ -778,10 +822,10 @@ class ShadingResults
 			}
 
 			// Cache so the next lookup on this thread doesn't need a lock.
-			return threadCache.insert( *it ).first->second;
+			return threadCache.debugResults.insert( *it ).first->second;
 		}
 
-		void addDebug( size_t pointIndex, const DebugParameters *parameters, const Color3f &weight, DebugResultsMap &threadCache )
+		void addDebug( size_t pointIndex, const DebugParameters *parameters, const Color3f &weight, ThreadCache &threadCache )
 		{
 			DebugResult debugResult = acquireDebugResult( parameters, threadCache );
 
@@ -801,6 +845,17 @@ class ShadingResults
 				dst += pointIndex;
 				*dst = parameters->stringValue.string();
 			}
+			else if( debugResult.type.basetype == TypeDesc::FLOAT && debugResult.type.aggregate <= TypeDesc::VEC3 )
+			{
+				// Fast path for the most common types, avoiding the
+				// overhead of `convertValue()`.
+				const Color3f value = weight * parameters->value;
+				float *dst = static_cast<float *>( debugResult.basePointer ) + pointIndex * debugResult.type.aggregate;
+				for( int i = 0; i < debugResult.type.aggregate; ++i )
+				{
+					dst[i] = value[i];
+				}
+			}
 			else
 			{
 				Color3f value = weight * parameters->value;
@@ -1173,17 +1228,17 @@ IECore::CompoundDataPtr ShadingEngine::shade( const IECore::CompoundData *points
 
 	// Iterate over the input points, doing the shading as we go
 
-	typedef tbb::enumerable_thread_specific<ShadingResults::DebugResultsMap> ThreadLocalDebugResults;
-	ThreadLocalDebugResults debugResultsCache;
+	typedef tbb::enumerable_thread_specific<ShadingResults::ThreadCache> ThreadLocalResultsCache;
+	ThreadLocalResultsCache resultsCache;
 
 	const IECore::Canceller *canceller = context->canceller();
 
 	ShadingSystem *shadingSystem = ::shadingSystem();
 	ShaderGroup &shaderGroup = **static_cast<ShaderGroupRef *>( m_shaderGroupRef );
 
-	auto f = [&shadingSystem, &renderState, &results, &shaderGlobals, &p, &u, &v, &uv, &n, &shaderGroup, &debugResultsCache, canceller]( const tbb::blocked_range<size_t> &r )
+	auto f = [&shadingSystem, &renderState, &results, &shaderGlobals, &p, &u, &v, &uv, &n, &shaderGroup, &resultsCache, canceller]( const tbb::blocked_range<size_t> &r )
 	{
-		ThreadLocalDebugResults::reference resultCache = debugResultsCache.local();
+		ThreadLocalResultsCache::reference resultCache = resultsCache.local();
 
 		ThreadRenderState threadRenderState( renderState );
 
@@ -70,6 +70,7 @@
 
 #include "tbb/concurrent_queue.h"
 
+#include <chrono>
 #include <functional>
 #include <unordered_map>
 #include <vector>
@@ -278,7 +279,27 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 			return selection.match( m_name ) & ( PathMatcher::AncestorMatch | PathMatcher::ExactMatch );
 		}
 
+		const IECoreGL::State *state() const
+		{
+			return m_attributes->state();
+		}
+
+		const IECoreGL::Renderable *renderable() const
+		{
+			return m_renderable.get();
+		}
+
 		void render( IECoreGL::State *currentState, const IECore::PathMatcher &selection ) const
+		{
+			IECoreGL::State::ScopedBinding scope( *state(), *currentState );
+			renderWithBoundState( currentState, selection );
+		}
+
+		// As for `render()`, but assumes that the caller has
+		// already bound `state()`. This allows objects sharing
+		// a state to be rendered without rebinding it for each
+		// object.
+		void renderWithBoundState( IECoreGL::State *currentState, const IECore::PathMatcher &selection ) const
 		{
 			const bool haveTransform = m_transform != M44f();
 			if( haveTransform )
@@ -287,7 +308,6 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 				glMultMatrixf( m_transform.getValue() );
 			}
 
-			IECoreGL::State::ScopedBinding scope( *m_attributes->state(), *currentState );
 			IECoreGL::State::ScopedBinding selectionScope( selectionState(), *currentState, selected( selection ) );
 
 			if( m_renderable )
@@ -404,7 +424,7 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 	public :
 
 		OpenGLRenderer( RenderType renderType, const std::string &fileName )
-			:	m_renderType( renderType ), m_baseStateOptions( new CompoundObject )
+			:	m_renderType( renderType ), m_baseStateOptions( new CompoundObject ), m_renderGroupsDirty( true )
 		{
 			if( renderType == SceneDescription )
 			{
@@ -505,6 +525,7 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			m_editQueue.push( [this, result, name]() {
 				m_objects.push_back( result );
 				m_cameras[name] = result;
+				m_renderGroupsDirty = true;
 			} );
 			return result;
 		}
@@ -522,7 +543,10 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 		Renderer::ObjectInterfacePtr object( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override
 		{
 			OpenGLObjectPtr result = new OpenGLObject( name, object, static_cast<const OpenGLAttributes *>( attributes ), m_editQueue );
-			m_editQueue.push( [this, result]() { m_objects.push_back( result ); } );
+			m_editQueue.push( [this, result]() {
+				m_objects.push_back( result );
+				m_renderGroupsDirty = true;
+			} );
 			return result;
 		}
 
@@ -561,6 +585,10 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			{
 				return querySelectedObjects( parameters );
 			}
+			else if( name == "gl:queryPendingEdits" )
+			{
+				return new BoolData( !m_editQueue.empty() );
+			}
 
 			throw IECore::Exception( "Unknown command" );
 		}
@@ -569,8 +597,18 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 
 		void renderInteractive()
 		{
-			processQueue();
-			removeDeletedObjects();
+			// When a large update arrives, applying all the edits in a single
+			// frame could stall the UI for a long time. So we limit the time
+			// spent, and leave the remaining edits for subsequent frames. Clients
+			// can use the "gl:queryPendingEdits" command to find out if another
+			// render is needed. Selection must be accurate though, so we always
+			// apply everything when selecting.
+			if( processQueue( IECoreGL::Selector::currentSelector() ? std::chrono::steady_clock::duration::max() : g_interactiveEditBudget ) )
+			{
+				// Pending edits may refer to objects that would otherwise
+				// be deleted, so we only remove them once the queue is empty.
+				removeDeletedObjects();
+			}
 			CachedConverter::defaultCachedConverter()->clearUnused();
 
 			GLint prevProgram;
@@ -638,7 +676,12 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			// We don't want to render the visualiser of the camera we're looking through.  For the viewport,
 			// we do this using SceneView::deleteObjectFilter, but here, instead of setting up a filter,
 			// we just delete the camera from the list of things to render.
+			const size_t numObjects = m_objects.size();
 			m_objects.erase( std::remove( m_objects.begin(), m_objects.end(), camera), m_objects.end() );
+			if( m_objects.size() != numObjects )
+			{
+				m_renderGroupsDirty = true;
+			}
 
 			const V2i resolution = camera->getResolution();
 			IECoreGL::FrameBufferPtr frameBuffer = new FrameBuffer;
@@ -681,6 +724,25 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			}
 		}
 
+		// Applies edits until the queue is empty or `budget` is exceeded,
+		// returning true if the queue was emptied.
+		bool processQueue( std::chrono::steady_clock::duration budget )
+		{
+			const auto startTime = std::chrono::steady_clock::now();
+			Edit edit;
+			while( m_editQueue.try_pop( edit ) )
+			{
+				edit();
+				if( std::chrono::steady_clock::now() - startTime > budget )
+				{
+					return m_editQueue.empty();
+				}
+			}
+			return true;
+		}
+
+		static const std::chrono::milliseconds g_interactiveEditBudget;
+
 		// During interactive renders, the client code controls the lifetime
 		// of objects by managing ObjectInterfacePtrs. But we also hold a
 		// reference to the objects ourselves so we can iterate to render them.
@@ -703,6 +765,7 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 				}
 			}
 
+			const size_t numObjects = m_objects.size();
 			m_objects.erase(
 				remove_if(
 					m_objects.begin(),
@@ -711,6 +774,10 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 				),
 				m_objects.end()
 			);
+			if( m_objects.size() != numObjects )
+			{
+				m_renderGroupsDirty = true;
+			}
 
 			m_attributes.erase(
 				remove_if(
@@ -724,17 +791,86 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 
 		void renderObjects( IECoreGL::State *currentState )
 		{
-			IECoreGL::Selector *selector = IECoreGL::Selector::currentSelector();
-
-			GLuint i = 1;
-			for( const auto &o : m_objects )
+			if( IECoreGL::Selector *selector = IECoreGL::Selector::currentSelector() )
 			{
-				if( selector )
+				// Each object must be loaded with a name matching its
+				// index in `m_objects`, so we render them individually
+				// and in order.
+				GLuint i = 1;
+				for( const auto &o : m_objects )
 				{
 					selector->loadName( i++ );
+					o->render( currentState, m_selection );
 				}
+				return;
+			}
+
+			updateRenderGroups();
+
+			vector<const OpenGLObject *> ungroupedObjects;
+			for( const auto &group : m_renderGroups )
+			{
+				IECoreGL::State::ScopedBinding scope( *group.state, *currentState );
+				for( const auto &o : group.objects )
+				{
+					if( o->state() != group.state )
+					{
+						// Attributes have been edited since the groups
+						// were built. Render separately for now, and
+						// rebuild the groups for next time.
+						ungroupedObjects.push_back( o );
+						continue;
+					}
+					o->renderWithBoundState( currentState, m_selection );
+				}
+			}
+
+			for( const auto &o : ungroupedObjects )
+			{
 				o->render( currentState, m_selection );
 			}
+			if( !ungroupedObjects.empty() )
+			{
+				m_renderGroupsDirty = true;
+			}
+		}
+
+		// Groups objects by state, so that each state is bound only once
+		// per render rather than once per object. This is significant for
+		// large numbers of small objects, where binding state can cost
+		// more than drawing. Within each group, objects sharing a renderable
+		// are drawn consecutively. This is common, because the converter
+		// cache returns the same renderable for objects with the same hash.
+		void updateRenderGroups()
+		{
+			if( !m_renderGroupsDirty )
+			{
+				return;
+			}
+
+			m_renderGroups.clear();
+			std::unordered_map<const IECoreGL::State *, size_t> groupIndices;
+			for( const auto &o : m_objects )
+			{
+				const auto inserted = groupIndices.insert( { o->state(), m_renderGroups.size() } );
+				if( inserted.second )
+				{
+					m_renderGroups.push_back( RenderGroup{ o->state(), {} } );
+				}
+				m_renderGroups[inserted.first->second].objects.push_back( o.get() );
+			}
+
+			for( auto &group : m_renderGroups )
+			{
+				std::stable_sort(
+					group.objects.begin(), group.objects.end(),
+					[] ( const OpenGLObject *a, const OpenGLObject *b ) {
+						return a->renderable() < b->renderable();
+					}
+				);
+			}
+
+			m_renderGroupsDirty = false;
 		}
 
 		void writeOutputs( const FrameBuffer *frameBuffer )
@@ -881,11 +1017,24 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 		typedef std::vector<OpenGLAttributesPtr> OpenGLAttributesVector;
 		OpenGLAttributesVector m_attributes;
 
+		// Render groups. Rebuilt from m_objects by `updateRenderGroups()`
+		// whenever objects are added or removed. The state is held by
+		// reference, so that it remains valid even if the objects'
+		// attributes are edited.
+		struct RenderGroup
+		{
+			IECoreGL::ConstStatePtr state;
+			vector<const OpenGLObject *> objects;
+		};
+		vector<RenderGroup> m_renderGroups;
+		bool m_renderGroupsDirty;
+
 		// Registration with factory
 		static Renderer::TypeDescription<OpenGLRenderer> g_typeDescription;
 
 };
 
 IECoreScenePreview::Renderer::TypeDescription<OpenGLRenderer> OpenGLRenderer::g_typeDescription( "OpenGL" );
+const std::chrono::milliseconds OpenGLRenderer::g_interactiveEditBudget( 20 );
 
 } // namespace
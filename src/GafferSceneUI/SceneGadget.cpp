@@ -416,6 +416,13 @@ Imath::Box3f SceneGadget::bound() const
 	return static_cast<Box3fData *>( d.get() )->readable();
 }
 
+Imath::Box3f SceneGadget::renderBound() const
+{
+	Box3f b;
+	b.makeInfinite();
+	return b;
+}
+
 void SceneGadget::doRenderLayer( Layer layer, const GafferUI::Style *style ) const
 {
 	if( layer != Layer::Main )
@@ -430,6 +437,20 @@ void SceneGadget::doRenderLayer( Layer layer, const GafferUI::Style *style ) con
 
 	const_cast<SceneGadget *>( this )->updateRenderer();
 	renderScene();
+	if( m_updateErrored )
+	{
+		return;
+	}
+
+	DataPtr pendingEdits = m_renderer->command( "gl:queryPendingEdits" );
+	if( static_cast<BoolData *>( pendingEdits.get() )->readable() )
+	{
+		// The renderer limits the time it spends applying
+		// edits in each frame, so large updates are displayed
+		// progressively over several frames. Arrange to be
+		// rendered again so the rest can be applied.
+		const_cast<SceneGadget *>( this )->requestRenderOnUIThread();
+	}
 }
 
 void SceneGadget::updateRenderer()
@@ -516,6 +537,21 @@ void SceneGadget::updateRenderer()
 	m_updateTask->waitFor( 0.1 );
 }
 
+void SceneGadget::requestRenderOnUIThread()
+{
+	if( refCount() && !m_renderRequestPending.exchange( true ) )
+	{
+		// Must hold a reference to stop us dying before our UI thread call is scheduled.
+		SceneGadgetPtr thisRef = this;
+		ParallelAlgo::callOnUIThread(
+			[thisRef] {
+				thisRef->m_renderRequestPending = false;
+				thisRef->requestRender();
+			}
+		);
+	}
+}
+
 void SceneGadget::renderScene() const
 {
 	if( m_updateErrored )
@@ -66,9 +66,33 @@ void testValuePlugContentionForOneItem()
 	);
 }
 
+void testValuePlugDirtyPropagationPerformance()
+{
+	// One plug feeding many nodes, as is common in
+	// lookdev scripts where a single plug drives every
+	// shader assignment.
+
+	NodePtr parent = new Node;
+	MultiplyNodePtr source = new MultiplyNode;
+	parent->addChild( source );
+
+	for( int i = 0; i < 10000; ++i )
+	{
+		MultiplyNodePtr node = new MultiplyNode;
+		parent->addChild( node );
+		node->op1Plug()->setInput( source->productPlug() );
+	}
+
+	for( int i = 0; i < 100; ++i )
+	{
+		source->op1Plug()->setValue( i );
+	}
+}
+
 } // namespace
 
 void GafferTestModule::bindValuePlugTest()
 {
 	def( "testValuePlugContentionForOneItem", &testValuePlugContentionForOneItem );
+	def( "testValuePlugDirtyPropagationPerformance", &testValuePlugDirtyPropagationPerformance );
 }
@@ -267,6 +267,13 @@ AnimationGadget::~AnimationGadget()
 {
 }
 
+Imath::Box3f AnimationGadget::renderBound() const
+{
+	Box3f b;
+	b.makeInfinite();
+	return b;
+}
+
 void AnimationGadget::doRenderLayer( Layer layer, const Style *style ) const
 {
 	Gadget::doRenderLayer( layer, style );
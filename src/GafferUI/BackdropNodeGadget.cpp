@@ -304,10 +304,15 @@ void BackdropNodeGadget::doRenderLayer( Layer layer, const Style *style ) const
 			);
 		}
 
+		// The title is typically large enough to remain legible
+		// when zoomed out, but the description is not.
+		const GraphGadget *graphGadget = parent<GraphGadget>();
+		const bool lowDetail = graphGadget && graphGadget->lowDetail();
+
 		Box2f textBound = bound;
 		textBound.min += V2f( g_margin );
 		textBound.max = V2f( textBound.max.x - g_margin, titleBaseline - g_margin );
-		if( textBound.hasVolume() )
+		if( textBound.hasVolume() && !lowDetail )
 		{
 			style->renderWrappedText( Style::BodyText, description, textBound );
 		}
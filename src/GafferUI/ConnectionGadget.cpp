@@ -131,6 +131,11 @@ bool ConnectionGadget::getMinimised() const
 	return m_minimised;
 }
 
+bool ConnectionGadget::lowDetailLine( Imath::V3f &srcPosition, Imath::V3f &dstPosition, Style::State &state, const Imath::Color3f *&userColor ) const
+{
+	return false;
+}
+
 ConnectionGadgetPtr ConnectionGadget::create( NodulePtr srcNodule, NodulePtr dstNodule )
 {
 	const Gaffer::Plug *plug = dstNodule->plug();
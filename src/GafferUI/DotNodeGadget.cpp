@@ -101,7 +101,9 @@ void DotNodeGadget::doRenderLayer( Layer layer, const Style *style ) const
 	const V3f s = b.size();
 	style->renderNodeFrame( Box2f( V2f( 0 ), V2f( 0 ) ), std::min( s.x, s.y ) / 2.0f, state, userColor() );
 
-	if( !m_label.empty() && !IECoreGL::Selector::currentSelector() )
+	const GraphGadget *graphGadget = parent<GraphGadget>();
+	const bool lowDetail = graphGadget && graphGadget->lowDetail();
+	if( !m_label.empty() && !lowDetail && !IECoreGL::Selector::currentSelector() )
 	{
 		glPushMatrix();
 		IECoreGL::glTranslate( m_labelPosition );
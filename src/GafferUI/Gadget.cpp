@@ -54,10 +54,83 @@ using namespace GafferUI;
 using namespace Imath;
 using namespace std;
 
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Returns true if the box is entirely outside one of the side
+// planes of clip space. The test is performed in homogeneous
+// coordinates so that it is valid for perspective projections
+// even when the box straddles the camera plane. Empty and infinite
+// boxes are never considered to be outside.
+bool outsideClipSpace( const Box3f &box, const M44f &toClip )
+{
+	if( box.isEmpty() || box.isInfinite() )
+	{
+		return false;
+	}
+
+	bool left = true, right = true, bottom = true, top = true;
+	for( int i = 0; i < 8; ++i )
+	{
+		const V3f p(
+			i & 1 ? box.max.x : box.min.x,
+			i & 2 ? box.max.y : box.min.y,
+			i & 4 ? box.max.z : box.min.z
+		);
+
+		const float x = p.x * toClip[0][0] + p.y * toClip[1][0] + p.z * toClip[2][0] + toClip[3][0];
+		const float y = p.x * toClip[0][1] + p.y * toClip[1][1] + p.z * toClip[2][1] + toClip[3][1];
+		const float w = p.x * toClip[0][3] + p.y * toClip[1][3] + p.z * toClip[2][3] + toClip[3][3];
+
+		left = left && x < -w;
+		right = right && x > w;
+		bottom = bottom && y < -w;
+		top = top && y > w;
+		if( !( left || right || bottom || top ) )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Render bounds are cached for the duration of each call to
+// `Gadget::render()`, which is identified by `g_renderGeneration`.
+// They can't be cached for longer, because `bound()` may be
+// overridden to return anything at all, without notifying us.
+// Rendering only ever happens on the UI thread.
+size_t g_renderGeneration = 0;
+int g_renderDepth = 0;
+
+struct RenderScope
+{
+
+	RenderScope()
+	{
+		if( !g_renderDepth++ )
+		{
+			g_renderGeneration++;
+		}
+	}
+
+	~RenderScope()
+	{
+		g_renderDepth--;
+	}
+
+};
+
+} // namespace
+
 IE_CORE_DEFINERUNTIMETYPED( Gadget );
 
 Gadget::Gadget( const std::string &name )
-	:	GraphComponent( name ), m_style( nullptr ), m_visible( true ), m_enabled( true ), m_highlighted( false ), m_toolTip( "" )
+	:	GraphComponent( name ), m_style( nullptr ), m_visible( true ), m_enabled( true ), m_highlighted( false ), m_renderBoundGeneration( 0 ), m_toolTip( "" )
 {
 	std::string n = "__Gaffer::Gadget::" + boost::lexical_cast<std::string>( (size_t)this );
 	m_glName = IECoreGL::NameStateComponent::glNameFromName( n, true );
@@ -255,13 +328,23 @@ Imath::M44f Gadget::fullTransform( const Gadget *ancestor ) const
 
 void Gadget::render() const
 {
+	// Get the transform from our parent's space to clip space,
+	// so that we can cull gadgets which are outside the viewport.
+	// When selecting, the projection includes the selection region,
+	// so this also culls gadgets which can't be selected.
+	M44f modelView, projection;
+	glGetFloatv( GL_MODELVIEW_MATRIX, modelView.getValue() );
+	glGetFloatv( GL_PROJECTION_MATRIX, projection.getValue() );
+	const M44f parentToClip = modelView * projection;
+
+	RenderScope renderScope;
 	for( int layer = (int)Layer::Back; layer <= (int)Layer::Front; ++layer )
 	{
-		renderLayer( (Layer)layer, /* currentStyle = */ nullptr );
+		renderLayer( (Layer)layer, /* currentStyle = */ nullptr, parentToClip );
 	}
 }
 
-void Gadget::renderLayer( Layer layer, const Style *currentStyle ) const
+void Gadget::renderLayer( Layer layer, const Style *currentStyle, const Imath::M44f &parentToClip ) const
 {
 	const bool haveTransform = m_transform != M44f();
 	if( haveTransform )
@@ -291,6 +374,7 @@ void Gadget::renderLayer( Layer layer, const Style *currentStyle ) const
 
 		doRenderLayer( layer, currentStyle );
 
+		const M44f toClip = haveTransform ? m_transform * parentToClip : parentToClip;
 		for( ChildContainer::const_iterator it=children().begin(); it!=children().end(); it++ )
 		{
 			// Cast is safe because of the guarantees acceptsChild() gives us
@@ -299,10 +383,15 @@ void Gadget::renderLayer( Layer layer, const Style *currentStyle ) const
 			{
 				continue;
 			}
-			if( c->hasLayer( layer ) )
+			if( !c->hasLayer( layer ) )
+			{
+				continue;
+			}
+			if( outsideClipSpace( c->cachedRenderBound(), c->getTransform() * toClip ) )
 			{
-				c->renderLayer( layer, currentStyle );
+				continue;
 			}
+			c->renderLayer( layer, currentStyle, toClip );
 		}
 
 	if( haveTransform )
@@ -348,6 +437,42 @@ Imath::Box3f Gadget::bound() const
 	return result;
 }
 
+Imath::Box3f Gadget::renderBound() const
+{
+	Box3f result = bound();
+	for( ChildContainer::const_iterator it=children().begin(); it!=children().end(); it++ )
+	{
+		// cast is safe because of the guarantees acceptsChild() gives us
+		const Gadget *c = static_cast<const Gadget *>( it->get() );
+		if( !c->getVisible() )
+		{
+			continue;
+		}
+		const Box3f b = c->cachedRenderBound();
+		if( b.isInfinite() )
+		{
+			return b;
+		}
+		result.extendBy( Imath::transform( b, c->getTransform() ) );
+	}
+	return result;
+}
+
+Imath::Box3f Gadget::cachedRenderBound() const
+{
+	if( !g_renderDepth )
+	{
+		return renderBound();
+	}
+
+	if( m_renderBoundGeneration != g_renderGeneration )
+	{
+		m_renderBound = renderBound();
+		m_renderBoundGeneration = g_renderGeneration;
+	}
+	return m_renderBound;
+}
+
 Imath::Box3f Gadget::transformedBound() const
 {
 	Box3f b = bound();
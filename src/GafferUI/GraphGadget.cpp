@@ -59,6 +59,8 @@
 #include "Gaffer/StandardSet.h"
 #include "Gaffer/TypedPlug.h"
 
+#include "IECoreGL/Selector.h"
+
 #include "IECore/BoxOps.h"
 #include "IECore/Export.h"
 #include "IECore/NullObject.h"
@@ -69,6 +71,9 @@ IECORE_POP_DEFAULT_VISIBILITY
 
 #include "boost/bind.hpp"
 #include "boost/bind/placeholders.hpp"
+#include "boost/format.hpp"
+
+#include <cstring>
 
 using namespace GafferUI;
 using namespace Imath;
@@ -104,6 +109,20 @@ const InternedString g_nodeGadgetTypeName( "nodeGadget:type" );
 const InternedString g_auxiliaryConnectionsGadgetName( "__auxiliaryConnections" );
 const InternedString g_annotationsGadgetName( "__annotations" );
 
+// When zoomed out beyond this number of pixels per unit,
+// we switch to drawing simplified proxies for nodes and
+// connections. This is roughly the point at which node names
+// become too small to read.
+const float g_lowDetailPixelsPerUnit = 4.0f;
+
+bool frameTimeVisible()
+{
+	const char *s = getenv( "GAFFERUI_GRAPHGADGET_SHOWFRAMETIME" );
+	return s && !strcmp( s, "1" );
+}
+
+const bool g_frameTimeVisible = frameTimeVisible();
+
 struct CompareV2fX{
 	bool operator()(const Imath::V2f &a, const Imath::V2f &b) const
 	{
@@ -120,7 +139,7 @@ struct CompareV2fX{
 IE_CORE_DEFINERUNTIMETYPED( GraphGadget );
 
 GraphGadget::GraphGadget( Gaffer::NodePtr root, Gaffer::SetPtr filter )
-	:	m_dragStartPosition( 0 ), m_lastDragPosition( 0 ), m_dragMode( None ), m_dragReconnectCandidate( nullptr ), m_dragReconnectSrcNodule( nullptr ), m_dragReconnectDstNodule( nullptr )
+	:	m_dragStartPosition( 0 ), m_lastDragPosition( 0 ), m_dragMode( None ), m_dragReconnectCandidate( nullptr ), m_dragReconnectSrcNodule( nullptr ), m_dragReconnectDstNodule( nullptr ), m_lowDetail( false )
 {
 	keyPressSignal().connect( boost::bind( &GraphGadget::keyPressed, this, ::_1,  ::_2 ) );
 	buttonPressSignal().connect( boost::bind( &GraphGadget::buttonPress, this, ::_1,  ::_2 ) );
@@ -648,6 +667,49 @@ ConnectionGadget *GraphGadget::reconnectionGadgetAt( const NodeGadget *gadget, c
 	return nullptr;
 }
 
+bool GraphGadget::lowDetail() const
+{
+	return m_lowDetail;
+}
+
+void GraphGadget::updateLowDetail() const
+{
+	m_lowDetail = false;
+	if( const ViewportGadget *viewportGadget = ancestor<ViewportGadget>() )
+	{
+		const float pixelsPerUnit = (
+			viewportGadget->gadgetToRasterSpace( V3f( 1, 0, 0 ), this ) -
+			viewportGadget->gadgetToRasterSpace( V3f( 0 ), this )
+		).length();
+		m_lowDetail = pixelsPerUnit < g_lowDetailPixelsPerUnit;
+	}
+}
+
+void GraphGadget::parentChanged( Gaffer::GraphComponent *oldParent )
+{
+	ContainerGadget::parentChanged( oldParent );
+
+	if( ViewportGadget *viewportGadget = ancestor<ViewportGadget>() )
+	{
+		m_viewportChangedConnection = viewportGadget->viewportChangedSignal().connect( boost::bind( &GraphGadget::updateLowDetail, this ) );
+		m_cameraChangedConnection = viewportGadget->cameraChangedSignal().connect( boost::bind( &GraphGadget::updateLowDetail, this ) );
+	}
+	else
+	{
+		m_viewportChangedConnection.disconnect();
+		m_cameraChangedConnection.disconnect();
+	}
+
+	updateLowDetail();
+}
+
+Imath::Box3f GraphGadget::renderBound() const
+{
+	Box3f b;
+	b.makeInfinite();
+	return b;
+}
+
 void GraphGadget::doRenderLayer( Layer layer, const Style *style ) const
 {
 	Gadget::doRenderLayer( layer, style );
@@ -657,8 +719,23 @@ void GraphGadget::doRenderLayer( Layer layer, const Style *style ) const
 	switch( layer )
 	{
 
+	case GraphLayer::Backdrops :
+
+		// This is the first layer to be rendered, so we use it to
+		// fix the level of detail for the whole render. We don't rely
+		// solely on the ViewportGadget's signals, because our ancestors
+		// may have changed since parentChanged() was called.
+		m_renderStartTime = std::chrono::steady_clock::now();
+		updateLowDetail();
+		break;
+
 	case GraphLayer::Connections :
 
+		if( m_lowDetail && !IECoreGL::Selector::currentSelector() )
+		{
+			renderLowDetailConnections( style );
+		}
+
 		// render the new drag connections if they exist
 		if ( m_dragReconnectCandidate )
 		{
@@ -699,6 +776,11 @@ void GraphGadget::doRenderLayer( Layer layer, const Style *style ) const
 			b.extendBy( viewportGadget->gadgetToRasterSpace( V3f( m_lastDragPosition.x, m_lastDragPosition.y, 0 ), this ) );
 			style->renderSelectionBox( b );
 		}
+
+		if( g_frameTimeVisible && !IECoreGL::Selector::currentSelector() )
+		{
+			renderFrameTime( style );
+		}
 		break;
 
 	default:
@@ -707,6 +789,86 @@ void GraphGadget::doRenderLayer( Layer layer, const Style *style ) const
 
 }
 
+void GraphGadget::renderLowDetailConnections( const Style *style ) const
+{
+	// Group the connections by drawing state, so that
+	// we can draw each group with a single call.
+
+	struct Batch
+	{
+		Style::State state;
+		const Imath::Color3f *userColor;
+		std::vector<V3f> positions;
+	};
+
+	std::vector<Batch> batches;
+	for( const auto &c : m_connectionGadgets )
+	{
+		const ConnectionGadget *connection = c.second;
+		if( !connection->getVisible() )
+		{
+			continue;
+		}
+
+		V3f srcPosition, dstPosition;
+		Style::State state;
+		const Imath::Color3f *userColor = nullptr;
+		if( !connection->lowDetailLine( srcPosition, dstPosition, state, userColor ) )
+		{
+			continue;
+		}
+
+		auto batch = std::find_if(
+			batches.begin(), batches.end(),
+			[state, userColor]( const Batch &b ) {
+				return
+					b.state == state &&
+					( b.userColor == userColor || ( b.userColor && userColor && *b.userColor == *userColor ) )
+				;
+			}
+		);
+		if( batch == batches.end() )
+		{
+			batches.push_back( { state, userColor, {} } );
+			batch = batches.end() - 1;
+		}
+
+		batch->positions.push_back( srcPosition );
+		batch->positions.push_back( dstPosition );
+	}
+
+	for( const auto &batch : batches )
+	{
+		style->renderLowDetailConnections( batch.positions, batch.state, batch.userColor );
+	}
+}
+
+void GraphGadget::renderFrameTime( const Style *style ) const
+{
+	// This is the last layer to be rendered, so this gives a good
+	// approximation of the time spent in the whole render. We can't
+	// account for time spent by the GPU without forcing a synchronisation,
+	// so this measures only the time taken to issue the drawing commands.
+	const std::chrono::duration<float, std::milli> duration = std::chrono::steady_clock::now() - m_renderStartTime;
+	const std::string text = boost::str(
+		boost::format( "%.1fms%s" ) % duration.count() % ( m_lowDetail ? " (low detail)" : "" )
+	);
+
+	const ViewportGadget *viewportGadget = ancestor<ViewportGadget>();
+	if( !viewportGadget )
+	{
+		return;
+	}
+
+	const float scale = 10.0f;
+	const Box3f bound = style->characterBound( Style::LabelText );
+
+	ViewportGadget::RasterScope rasterScope( viewportGadget );
+	glTranslatef( 10.0f, 10.0f + scale * bound.max.y, 0.0f );
+	glScalef( scale, -scale, scale );
+	style->renderText( Style::LabelText, text );
+}
+
 bool GraphGadget::keyPressed( GadgetPtr gadget, const KeyEvent &event )
 {
 	if( event.key == "D" )
@@ -122,6 +122,13 @@ Imath::Box3f Handle::bound() const
 	return Box3f( V3f( -1 ), V3f( 1 ) );
 }
 
+Imath::Box3f Handle::renderBound() const
+{
+	Box3f b;
+	b.makeInfinite();
+	return b;
+}
+
 bool Handle::hasLayer( Layer layer ) const
 {
 	return layer == Layer::MidFront;
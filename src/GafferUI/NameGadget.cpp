@@ -36,6 +36,8 @@
 
 #include "GafferUI/NameGadget.h"
 
+#include "GafferUI/GraphGadget.h"
+
 #include "boost/bind.hpp"
 #include "boost/bind/placeholders.hpp"
 
@@ -53,6 +55,17 @@ NameGadget::~NameGadget()
 {
 }
 
+void NameGadget::doRenderLayer( Layer layer, const Style *style ) const
+{
+	const GraphGadget *graphGadget = ancestor<GraphGadget>();
+	if( graphGadget && graphGadget->lowDetail() )
+	{
+		return;
+	}
+
+	TextGadget::doRenderLayer( layer, style );
+}
+
 void NameGadget::nameChanged( Gaffer::GraphComponentPtr object )
 {
 	setText( object->getName() );
@@ -229,6 +229,11 @@ void PlugAdder::doRenderLayer( Layer layer, const Style *style ) const
 		case GraphLayer::Nodes :
 			if( !getHighlighted() )
 			{
+				const GraphGadget *graphGadget = ancestor<GraphGadget>();
+				if( graphGadget && graphGadget->lowDetail() && !IECoreGL::Selector::currentSelector() )
+				{
+					break;
+				}
 				const float radius = 0.75f;
 				style->renderImage( Box2f( V2f( -radius ), V2f( radius ) ), texture( Style::NormalState ) );
 			}
@@ -49,6 +49,8 @@
 #include "Gaffer/StandardSet.h"
 #include "Gaffer/UndoScope.h"
 
+#include "IECoreGL/Selector.h"
+
 #include "OpenEXR/ImathBoxAlgo.h"
 #include "OpenEXR/ImathFun.h"
 
@@ -130,6 +132,11 @@ bool StandardConnectionGadget::highlighted() const
 	return false;
 }
 
+bool StandardConnectionGadget::lowDetailCompatible() const
+{
+	return !m_auxiliary && !m_dragEnd && !m_addingConnection && !m_dotPreview;
+}
+
 void StandardConnectionGadget::minimisedPositionAndTangent( bool highlighted, Imath::V3f &position, Imath::V3f &tangent ) const
 {
 	const bool minimise = !highlighted && getMinimised();
@@ -228,6 +235,31 @@ Imath::Box3f StandardConnectionGadget::bound() const
 	return r;
 }
 
+Imath::Box3f StandardConnectionGadget::renderBound() const
+{
+	Box3f r = bound();
+
+	V3f minimisedSrcPos, minimisedSrcTangent;
+	minimisedPositionAndTangent( highlighted(), minimisedSrcPos, minimisedSrcTangent );
+	r.extendBy( minimisedSrcPos );
+
+	if( m_addingConnection )
+	{
+		r.extendBy( m_dstPosOrig );
+	}
+
+	if( m_dotPreview )
+	{
+		r.extendBy( m_dotPreviewLocation );
+	}
+
+	// The curve may bulge outside the box containing its
+	// end points, and is drawn with a non-zero width.
+	r.min -= V3f( 5, 5, 0 );
+	r.max += V3f( 5, 5, 0 );
+	return r;
+}
+
 bool StandardConnectionGadget::canCreateConnection( const Gaffer::Plug *endpoint ) const
 {
 	if( m_dragEnd != endpoint->direction() )
@@ -307,6 +339,17 @@ void StandardConnectionGadget::doRenderLayer( Layer layer, const Style *style )
 		return;
 	}
 
+	if( lowDetailCompatible() && !IECoreGL::Selector::currentSelector() )
+	{
+		const GraphGadget *graphGadget = parent<GraphGadget>();
+		if( graphGadget && graphGadget->lowDetail() )
+		{
+			// The GraphGadget has already drawn us as part
+			// of a batch, using `lowDetailLine()`.
+			return;
+		}
+	}
+
 	const_cast<StandardConnectionGadget *>( this )->updateConnectionGeometry();
 	const Style::State state = highlighted() ? Style::HighlightedState : Style::NormalState;
 
@@ -353,6 +396,24 @@ Imath::V3f StandardConnectionGadget::closestPoint( const Imath::V3f& p ) const
 	return style()->closestPointOnConnection( p, minimisedSrcPos, minimisedSrcTangent, m_dstPos, m_dstTangent );
 }
 
+bool StandardConnectionGadget::lowDetailLine( Imath::V3f &srcPosition, Imath::V3f &dstPosition, Style::State &state, const Imath::Color3f *&userColor ) const
+{
+	if( !lowDetailCompatible() )
+	{
+		return false;
+	}
+
+	const_cast<StandardConnectionGadget *>( this )->updateConnectionGeometry();
+	state = highlighted() ? Style::HighlightedState : Style::NormalState;
+
+	V3f srcTangent;
+	minimisedPositionAndTangent( state == Style::HighlightedState, srcPosition, srcTangent );
+	dstPosition = m_dstPos;
+	userColor = m_userColor.get_ptr();
+
+	return true;
+}
+
 float StandardConnectionGadget::distanceToNodeGadget( const IECore::LineSegment3f &line, const Nodule *nodule ) const
 {
 	const NodeGadget *nodeGadget = nodule ? nodule->ancestor<NodeGadget>() : nullptr;
@@ -369,6 +369,23 @@ Imath::Box3f StandardNodeGadget::bound() const
 	return b;
 }
 
+Imath::Box3f StandardNodeGadget::renderBound() const
+{
+	// Include all children, so that we account for the error
+	// gadget as well as the full frame and nodules (including any
+	// connections being dragged from them), and leave a little room
+	// for the frame's outline.
+	Box3f b = NodeGadget::renderBound();
+	if( b.isInfinite() )
+	{
+		return b;
+	}
+	b.min -= V3f( 1, 1, 0 );
+	b.max += V3f( 1, 1, 0 );
+
+	return b;
+}
+
 void StandardNodeGadget::doRenderLayer( Layer layer, const Style *style ) const
 {
 	NodeGadget::doRenderLayer( layer, style );
@@ -112,6 +112,20 @@ Imath::Box3f StandardNodule::bound() const
 	return Box3f( V3f( -0.5, -0.5, 0 ), V3f( 0.5, 0.5, 0 ) );
 }
 
+Imath::Box3f StandardNodule::renderBound() const
+{
+	Box3f b = Nodule::renderBound();
+	if( m_draggingConnection )
+	{
+		// The connection may bulge outside the box containing
+		// its end points, and is drawn with a non-zero width.
+		b.extendBy( m_dragPosition );
+		b.min -= V3f( 5, 5, 0 );
+		b.max += V3f( 5, 5, 0 );
+	}
+	return b;
+}
+
 bool StandardNodule::canCreateConnection( const Gaffer::Plug *endpoint ) const
 {
 	const Gaffer::Plug *localPlug = plug();
@@ -197,6 +211,14 @@ void StandardNodule::doRenderLayer( Layer layer, const Style *style ) const
 
 			if( !getHighlighted() )
 			{
+				// Skip drawing when we would be too small to see, but
+				// continue to be drawn for selection so that connections
+				// can still be made.
+				const GraphGadget *graphGadget = ancestor<GraphGadget>();
+				if( graphGadget && graphGadget->lowDetail() && !IECoreGL::Selector::currentSelector() )
+				{
+					break;
+				}
 				style->renderNodule( 0.5f, Style::NormalState, m_userColor.get_ptr() );
 			}
 			break;
@@ -725,6 +725,29 @@ void StandardStyle::renderConnection( const Imath::V3f &srcPosition, const Imath
 	renderConnectionInternal( srcPosition, srcTangent, dstPosition, dstTangent );
 }
 
+void StandardStyle::renderLowDetailConnections( const std::vector<Imath::V3f> &positions, State state, const Imath::Color3f *userColor ) const
+{
+	if( positions.empty() )
+	{
+		return;
+	}
+
+	glUniform1i( g_isCurveParameter, 0 );
+	glUniform1i( g_borderParameter, 0 );
+	glUniform1i( g_edgeAntiAliasingParameter, 0 );
+	glUniform1i( g_textureTypeParameter, 0 );
+
+	glColor( colorForState( ConnectionColor, state, userColor ) );
+
+	glPushClientAttrib( GL_CLIENT_VERTEX_ARRAY_BIT );
+
+		glEnableClientState( GL_VERTEX_ARRAY );
+		glVertexPointer( 3, GL_FLOAT, 0, positions.data() );
+		glDrawArrays( GL_LINES, 0, positions.size() );
+
+	glPopClientAttrib();
+}
+
 void StandardStyle::renderAuxiliaryConnection( const Imath::Box2f &srcNodeFrame, const Imath::Box2f &dstNodeFrame, State state ) const
 {
 	glUniform1i( g_isCurveParameter, 1 );
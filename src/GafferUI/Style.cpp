@@ -43,6 +43,7 @@
 #include "IECore/SimpleTypedData.h"
 
 using namespace GafferUI;
+using namespace Imath;
 
 IE_CORE_DEFINERUNTIMETYPED( Style );
 
@@ -56,6 +57,17 @@ Style::~Style()
 {
 }
 
+void Style::renderLowDetailConnections( const std::vector<Imath::V3f> &positions, State state, const Imath::Color3f *userColor ) const
+{
+	for( size_t i = 0; i + 1 < positions.size(); i += 2 )
+	{
+		const V3f &srcPosition = positions[i];
+		const V3f &dstPosition = positions[i+1];
+		const V3f srcTangent = ( dstPosition - srcPosition ).normalized();
+		renderConnection( srcPosition, srcTangent, dstPosition, -srcTangent, state, userColor );
+	}
+}
+
 Style::UnarySignal &Style::changedSignal()
 {
 	return m_changedSignal;
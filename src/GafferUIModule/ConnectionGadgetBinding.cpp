@@ -52,6 +52,7 @@
 using namespace boost::python;
 using namespace GafferUIBindings;
 using namespace GafferUI;
+using namespace Imath;
 
 namespace
 {
@@ -96,6 +97,22 @@ void registerConnectionGadget2( IECore::TypeId nodeType, const std::string &dstP
 	ConnectionGadget::registerConnectionGadget( nodeType, dstPlugPathRegex, ConnectionGadgetCreator( creator ) );
 }
 
+object lowDetailLine( const ConnectionGadget &c )
+{
+	V3f srcPosition, dstPosition;
+	Style::State state = Style::NormalState;
+	const Color3f *userColor = nullptr;
+	if( !c.lowDetailLine( srcPosition, dstPosition, state, userColor ) )
+	{
+		return object();
+	}
+
+	return boost::python::make_tuple(
+		srcPosition, dstPosition, state,
+		userColor ? object( *userColor ) : object()
+	);
+}
+
 } // namespace
 
 void GafferUIModule::bindConnectionGadget()
@@ -106,6 +123,7 @@ void GafferUIModule::bindConnectionGadget()
 		.def( "setNodules", &ConnectionGadget::setNodules )
 		.def( "setMinimised", &ConnectionGadget::setMinimised )
 		.def( "getMinimised", &ConnectionGadget::getMinimised )
+		.def( "lowDetailLine", &lowDetailLine )
 		.def( "create", &ConnectionGadget::create )
 		.staticmethod( "create" )
 		.def( "registerConnectionGadget", &registerConnectionGadget1 )